@@ -1,6 +1,11 @@
 #ifndef INCLUDE_DS3231_H_
 #define INCLUDE_DS3231_H_
 
+#include <stdint.h>
+#include <time.h>
+
+#include "i2c.h"
+
 #define DS3231_ADDR7	0x68
 #define DS3231_ADDR8	0xD0
 
@@ -0,0 +1,192 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Common RTC interface backend for the AVR DS3231 library
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include "rtc.h"
+#include "ds3231.h"
+
+//registers
+#define RTC_SECONDS		0x00
+#define RTC_ALARM1		0x07
+#define RTC_CONTROL		0x0E
+#define RTC_STATUS		0x0F
+#define RTC_TEMP_MSB	0x11
+
+//control and status bits
+#define RTC_A1IE		0x01
+#define RTC_INTCN		0x04
+#define RTC_A1F			0x01
+
+//the AVR I2C driver does not report bus errors, so neither can this backend
+
+rtc_err_t rtc_init(void* bus)
+{
+	(void)bus;
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_get_datetime(rtc_datetime_t* datetime)
+{
+	u08 raw[RTC_BCD_TIME_SIZE];
+
+	i2c_read_bytes(DS3231_ADDR8, RTC_SECONDS, RTC_BCD_TIME_SIZE, raw);
+
+	rtc_decode_bcd_time(raw, datetime);
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_set_datetime(const rtc_datetime_t* datetime)
+{
+	u08 raw[RTC_BCD_TIME_SIZE];
+
+	if(datetime->year < 2000 || datetime->year > 2099)
+		return RTC_ERR_RANGE;
+
+	rtc_encode_bcd_time(datetime, raw);
+	//century bit, rtc_get_time reads years without it as 19xx
+	raw[5] |= 0x80;
+
+	i2c_write_bytes(DS3231_ADDR8, RTC_SECONDS, RTC_BCD_TIME_SIZE, raw);
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_get_epoch(uint32_t* epoch)
+{
+	rtc_datetime_t datetime;
+
+	rtc_get_datetime(&datetime);
+
+	*epoch = rtc_to_epoch(&datetime);
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_set_epoch(uint32_t epoch)
+{
+	rtc_datetime_t datetime;
+
+	rtc_from_epoch(epoch, &datetime);
+
+	return rtc_set_datetime(&datetime);
+}
+
+rtc_err_t rtc_set_alarm(uint32_t epoch)
+{
+	rtc_datetime_t datetime;
+	u08 alarm[4];
+	u08 control_register, status_register;
+	uint32_t now;
+
+	rtc_get_epoch(&now);
+
+	//the month and year are not matched, so the epoch has to be the next
+	//time its date and time come round or the alarm would fire early
+	if(epoch <= now || rtc_next_date_match(now, epoch) != epoch)
+		return RTC_ERR_RANGE;
+
+	rtc_from_epoch(epoch, &datetime);
+
+	//all mask bits clear, DY/DT clear: match date, hours, minutes, seconds
+	alarm[0] = rtc_dec2bcd(datetime.sec);
+	alarm[1] = rtc_dec2bcd(datetime.min);
+	alarm[2] = rtc_dec2bcd(datetime.hour);
+	alarm[3] = rtc_dec2bcd(datetime.date);
+
+	i2c_write_bytes(DS3231_ADDR8, RTC_ALARM1, 4, alarm);
+
+	i2c_read_bytes(DS3231_ADDR8, RTC_STATUS, 1, &status_register);
+	status_register &= ~RTC_A1F;
+	i2c_write_bytes(DS3231_ADDR8, RTC_STATUS, 1, &status_register);
+
+	i2c_read_bytes(DS3231_ADDR8, RTC_CONTROL, 1, &control_register);
+	control_register |= RTC_INTCN | RTC_A1IE;
+	i2c_write_bytes(DS3231_ADDR8, RTC_CONTROL, 1, &control_register);
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_clear_alarm(void)
+{
+	u08 control_register, status_register;
+
+	i2c_read_bytes(DS3231_ADDR8, RTC_CONTROL, 1, &control_register);
+	control_register &= ~RTC_A1IE;
+	i2c_write_bytes(DS3231_ADDR8, RTC_CONTROL, 1, &control_register);
+
+	i2c_read_bytes(DS3231_ADDR8, RTC_STATUS, 1, &status_register);
+	status_register &= ~RTC_A1F;
+	i2c_write_bytes(DS3231_ADDR8, RTC_STATUS, 1, &status_register);
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_alarm_fired(uint8_t* fired)
+{
+	u08 status_register;
+
+	i2c_read_bytes(DS3231_ADDR8, RTC_STATUS, 1, &status_register);
+
+	*fired = status_register & RTC_A1F;
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_get_temperature(int16_t* quarter_degrees)
+{
+	u08 raw[2];
+
+	i2c_read_bytes(DS3231_ADDR8, RTC_TEMP_MSB, 2, raw);
+
+	*quarter_degrees = (int16_t)((int8_t)raw[0]) * 4 + (raw[1] >> 6);
+
+	return RTC_OK;
+}
+
+uint8_t rtc_sram_size(void)
+{
+	return 0;
+}
+
+rtc_err_t rtc_read_sram(uint8_t offset, uint8_t* data, uint8_t length)
+{
+	(void)offset;
+	(void)data;
+	(void)length;
+
+	return RTC_ERR_UNSUPPORTED;
+}
+
+rtc_err_t rtc_write_sram(uint8_t offset, const uint8_t* data, uint8_t length)
+{
+	(void)offset;
+	(void)data;
+	(void)length;
+
+	return RTC_ERR_UNSUPPORTED;
+}
@@ -0,0 +1,43 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Stand-in for <avr/interrupt.h> to build the I2C driver on a host
+ *	
+ * ISR defines a plain function that the host program calls when its TWI
+ * model raises the interrupt.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef HOST_AVR_INTERRUPT_H_
+#define HOST_AVR_INTERRUPT_H_
+
+#include <avr/io.h>
+
+#define ISR(vector)	void vector(void)
+
+#define cli()	(SREG &= 0x7F)
+#define sei()	(SREG |= 0x80)
+
+void TWI_vect(void);
+
+#endif /* HOST_AVR_INTERRUPT_H_ */
@@ -0,0 +1,56 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Stand-in for <avr/io.h> to build the I2C driver on a host
+ *	
+ * Only the TWI and port registers used by i2c.c are declared, they are
+ * plain variables defined by the host program.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef HOST_AVR_IO_H_
+#define HOST_AVR_IO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+extern volatile uint8_t TWCR, TWSR, TWDR, TWBR, TWAR, SREG, PORTC, PORTD;
+
+//TWCR
+#define TWINT	7
+#define TWEA	6
+#define TWSTA	5
+#define TWSTO	4
+#define TWWC	3
+#define TWEN	2
+#define TWIE	0
+
+//TWSR
+#define TWPS1	1
+#define TWPS0	0
+
+#ifndef F_CPU
+#define F_CPU	16000000UL
+#endif
+
+#endif /* HOST_AVR_IO_H_ */
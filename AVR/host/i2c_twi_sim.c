@@ -0,0 +1,275 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Host simulation of the interrupt driven TWI transaction queue
+ *	
+ * A model of the ATmega TWI master and of one register file device at
+ * 0xD0 runs the queue in i2c.c. Each write of TWCR with TWINT set is
+ * carried out by the model, which sets TWSR and calls TWI_vect the way
+ * the hardware raises the interrupt. The program queues writes, reads,
+ * a NACKed device and a transaction submitted from a callback, checks
+ * the data, results and callbacks, and checks that transactions i2c_submit
+ * must reject are never put on the bus. Returns non zero on failure.
+ *
+ * Build and run from the AVR directory:
+ *	gcc -O2 -Wall -Ihost -I. host/i2c_twi_sim.c i2c.c -o i2c_twi_sim
+ *	./i2c_twi_sim
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/twi.h>
+
+#include "i2c.h"
+
+#define DEVICE_ADDRESS	0xD0
+
+volatile uint8_t TWCR, TWSR, TWDR, TWBR, TWAR, SREG, PORTC, PORTD;
+
+typedef enum {
+	BUS_IDLE,
+	BUS_ADDRESS,	//start sent, address byte expected
+	BUS_WRITE,		//device addressed for writing
+	BUS_READ		//device addressed for reading
+} bus_phase_t;
+
+static struct {
+	bus_phase_t phase;
+	uint8_t owned;			//start sent and no stop since
+	uint8_t pointer_set;	//first byte of a write sets the pointer
+	uint8_t pointer;
+	uint8_t reg[256];
+
+	uint32_t starts;
+	uint32_t stops;
+	uint32_t interrupts;
+	uint32_t bytes;
+} bus;
+
+static uint32_t callbacks;
+static uint32_t failures;
+
+#define CHECK(cond)	do{ if(!(cond)){ printf("line %d: %s\n", __LINE__, #cond); \
+		failures++; } }while(0)
+
+//carries out the last TWCR write, returns 1 if the interrupt is raised
+static uint8_t twi_step(void)
+{
+	uint8_t twcr = TWCR;
+
+	if(!(twcr & (1 << TWINT)))
+		return 0;
+	TWCR &= ~((1 << TWINT) | (1 << TWSTA) | (1 << TWSTO));
+
+	if(twcr & (1 << TWSTO)){
+		bus.stops++;
+		bus.owned = 0;
+		bus.phase = BUS_IDLE;
+		if(!(twcr & (1 << TWSTA)))
+			return 0;
+	}
+
+	if(twcr & (1 << TWSTA)){
+		TWSR = bus.owned ? TW_REP_START : TW_START;
+		bus.owned = 1;
+		bus.phase = BUS_ADDRESS;
+		bus.starts++;
+		return 1;
+	}
+
+	switch(bus.phase){
+	case BUS_ADDRESS:
+		if((TWDR & 0xFE) != DEVICE_ADDRESS){
+			TWSR = (TWDR & 0x01) ? TW_MR_SLA_NACK : TW_MT_SLA_NACK;
+		}else if(TWDR & 0x01){
+			bus.phase = BUS_READ;
+			TWSR = TW_MR_SLA_ACK;
+		}else{
+			bus.phase = BUS_WRITE;
+			bus.pointer_set = 0;
+			TWSR = TW_MT_SLA_ACK;
+		}
+		return 1;
+	case BUS_WRITE:
+		bus.bytes++;
+		if(!bus.pointer_set){
+			bus.pointer = TWDR;
+			bus.pointer_set = 1;
+		}else
+			bus.reg[bus.pointer++] = TWDR;
+		TWSR = TW_MT_DATA_ACK;
+		return 1;
+	case BUS_READ:
+		bus.bytes++;
+		TWDR = bus.reg[bus.pointer++];
+		TWSR = (twcr & (1 << TWEA)) ? TW_MR_DATA_ACK : TW_MR_DATA_NACK;
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static void twi_run(void)
+{
+	while(twi_step()){
+		bus.interrupts++;
+		TWI_vect();
+	}
+}
+
+static void count(i2c_transaction_t* transaction)
+{
+	(void)transaction;
+	callbacks++;
+}
+
+static i2c_transaction_t chained;
+static u08 chained_rx[3];
+
+//queues another read while the queue still holds transfers
+static void chain(i2c_transaction_t* transaction)
+{
+	callbacks++;
+	chained = (i2c_transaction_t){
+		.device_address = DEVICE_ADDRESS,
+		.use_register = TRUE,
+		.register_address = 0x10,
+		.rx = chained_rx,
+		.rx_length = sizeof(chained_rx),
+		.callback = count,
+	};
+	CHECK(i2c_submit(&chained) == TRUE);
+	(void)transaction;
+}
+
+static void check_queue(void)
+{
+	u08 w[4] = {1, 2, 3, 4}, r[7], expected[7], r2[2], r3[1];
+	uint32_t i;
+
+	i2c_transaction_t write = {
+		.device_address = DEVICE_ADDRESS, .use_register = TRUE,
+		.register_address = 0x20, .tx = w, .tx_length = sizeof(w),
+		.callback = count,
+	};
+	i2c_transaction_t read = {
+		.device_address = DEVICE_ADDRESS, .use_register = TRUE,
+		.register_address = 0x1F, .rx = r, .rx_length = sizeof(r),
+		.callback = chain,
+	};
+	i2c_transaction_t absent = {
+		.device_address = 0xA0, .use_register = TRUE,
+		.register_address = 0, .rx = r2, .rx_length = sizeof(r2),
+		.callback = count,
+	};
+	i2c_transaction_t read_only = {
+		.device_address = DEVICE_ADDRESS, .rx = r3,
+		.rx_length = sizeof(r3), .callback = count,
+	};
+
+	for(i = 0; i < 256; i++)
+		bus.reg[i] = i ^ 0x5A;
+
+	CHECK(i2c_submit(&write) == TRUE);
+	CHECK(i2c_submit(&read) == TRUE);
+	CHECK(i2c_submit(&absent) == TRUE);
+	CHECK(i2c_submit(&read_only) == TRUE);
+	twi_run();
+
+	//each transfer is written before the next one reads
+	expected[0] = 0x1F ^ 0x5A;
+	memcpy(expected + 1, w, sizeof(w));
+	expected[5] = 0x24 ^ 0x5A;
+	expected[6] = 0x25 ^ 0x5A;
+
+	CHECK(write.result == I2C_DONE && !memcmp(&bus.reg[0x20], w, sizeof(w)));
+	CHECK(read.result == I2C_DONE && !memcmp(r, expected, sizeof(r)));
+	CHECK(absent.result == I2C_NACK);
+	//the read-only transfer continues from the pointer the last read left
+	CHECK(read_only.result == I2C_DONE && r3[0] == (0x26 ^ 0x5A));
+	CHECK(chained.result == I2C_DONE && chained_rx[0] == (0x10 ^ 0x5A) &&
+			chained_rx[2] == (0x12 ^ 0x5A));
+	CHECK(callbacks == 5);
+	CHECK(!i2c_busy());
+
+	printf("queue: %u interrupts, %u starts, %u stops, %u bytes, "
+			"%u callbacks\n", bus.interrupts, bus.starts, bus.stops,
+			bus.bytes, callbacks);
+}
+
+static void check_rejected(void)
+{
+	static u08 data[255];
+	uint32_t starts = bus.starts;
+
+	//255 bytes and the register address do not fit the u08 byte count
+	i2c_transaction_t too_long = {
+		.device_address = DEVICE_ADDRESS, .use_register = TRUE,
+		.tx = data, .tx_length = 255, .callback = count,
+	};
+	i2c_transaction_t empty = {
+		.device_address = DEVICE_ADDRESS, .callback = count,
+	};
+	//255 bytes without a register address and a bare register write fit
+	i2c_transaction_t longest = {
+		.device_address = DEVICE_ADDRESS, .tx = data, .tx_length = 255,
+	};
+	i2c_transaction_t pointer = {
+		.device_address = DEVICE_ADDRESS, .use_register = TRUE,
+		.register_address = 0x30,
+	};
+
+	callbacks = 0;
+
+	CHECK(i2c_submit(&too_long) == FALSE && too_long.result == I2C_INVALID);
+	CHECK(i2c_submit(&empty) == FALSE && empty.result == I2C_INVALID);
+	//waits on the result, so returns only because nothing was queued
+	i2c_write_bytes(DEVICE_ADDRESS, 0, 255, data);
+	CHECK(bus.starts == starts && callbacks == 0 && !i2c_busy());
+
+	memset(data, 0xC3, sizeof(data));
+	CHECK(i2c_submit(&longest) == TRUE);
+	CHECK(i2c_submit(&pointer) == TRUE);
+	twi_run();
+	CHECK(longest.result == I2C_DONE && bus.reg[0xC3] == 0xC3 &&
+			bus.reg[(0xC3 + 253) & 0xFF] == 0xC3);
+	CHECK(pointer.result == I2C_DONE && bus.pointer == 0x30);
+
+	printf("rejected: too long %u, empty %u\n", too_long.result,
+			empty.result);
+}
+
+int main(void)
+{
+	SREG = 0x80;
+
+	check_queue();
+	check_rejected();
+
+	printf(failures ? "FAILED\n" : "passed\n");
+	return failures != 0;
+}
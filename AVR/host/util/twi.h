@@ -0,0 +1,48 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Stand-in for <util/twi.h> to build the I2C driver on a host
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef HOST_UTIL_TWI_H_
+#define HOST_UTIL_TWI_H_
+
+#include <avr/io.h>
+
+#define TW_STATUS		(TWSR & 0xF8)
+
+#define TW_START		0x08
+#define TW_REP_START	0x10
+#define TW_MT_SLA_ACK	0x18
+#define TW_MT_SLA_NACK	0x20
+#define TW_MT_DATA_ACK	0x28
+#define TW_MT_DATA_NACK	0x30
+#define TW_MT_ARB_LOST	0x38
+#define TW_MR_SLA_ACK	0x40
+#define TW_MR_SLA_NACK	0x48
+#define TW_MR_DATA_ACK	0x50
+#define TW_MR_DATA_NACK	0x58
+#define TW_BUS_ERROR	0x00
+
+#endif /* HOST_UTIL_TWI_H_ */
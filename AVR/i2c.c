@@ -1,5 +1,20 @@
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/twi.h>
+
 #include "i2c.h"
 
+//TWCR values used by the interrupt driven engine
+#define I2C_TWCR_RUN	(BV(TWINT)|BV(TWEN)|BV(TWIE))
+#define I2C_TWCR_ACK	(I2C_TWCR_RUN|BV(TWEA))
+#define I2C_TWCR_START	(I2C_TWCR_RUN|BV(TWSTA))
+#define I2C_TWCR_STOP	(I2C_TWCR_RUN|BV(TWSTO))
+
+static i2c_transaction_t* volatile i2c_queue_head = NULL;
+static i2c_transaction_t* i2c_queue_tail = NULL;
+static volatile eI2cStateType i2c_state = I2C_IDLE;
+static u08 i2c_index;
+
 void i2c_init(){
 
 	//set pull up resistors
@@ -8,19 +23,14 @@ void i2c_init(){
 	sbi(PORTD, 0);	// i2c SCL on ATmega128,64
 	sbi(PORTD, 1);	// i2c SDA on ATmega128,64
 
-	// clear SlaveReceive and SlaveTransmit handler to null
-	i2cSlaveReceive = 0;
-	i2cSlaveTransmit = 0;
-
 	//set bitrate
 	i2c_set_bitrate(100);
 
 	//enable TWI
 	sbi(TWCR,TWEN);
 
-	//enable TWI interrupt and slave address ACK
+	//enable TWI interrupt, only master mode is handled so no slave ACK
 	sbi(TWCR,TWIE);
-	sbi(TWCR,TWEA);
 
 	sei();
 }
@@ -127,34 +137,30 @@ u08 i2c_send_start(u08 device_address, u08 read)
 
 void i2c_read_bytes(u08 device_address, u08 register_address, u08 number_of_bytes, u08* data)
 {
-
-	u08 no_start_error = i2c_set_register_pointer(device_address, register_address, TRUE);
-
-	if(no_start_error){
-
-		//need to now send start again and send addr byte w bit set
-		no_start_error = i2c_send_start(device_address, TRUE);
-
-		if(no_start_error){
-			for(u08 i=0; i<(number_of_bytes-1); i++){
-				data[i] = i2c_receive_byte_to_register_w_ack();
-			}
-			data[number_of_bytes-1] = i2c_receive_byte_to_register_wo_ack();
-		}
-		i2c_send_stop();
-	}
+	i2c_transaction_t transaction = {
+		.device_address = device_address,
+		.use_register = TRUE,
+		.register_address = register_address,
+		.rx = data,
+		.rx_length = number_of_bytes,
+	};
+
+	i2c_submit(&transaction);
+	i2c_wait(&transaction);
 }
 
 void i2c_write_bytes(u08 device_address, u08 register_address, u08 number_of_bytes, u08* data)
 {
-	u08 no_start_error = i2c_set_register_pointer(device_address, register_address, FALSE);
-
-	if(no_start_error){
-		for(u08 i=0; i<(number_of_bytes); i++){
-			i2c_send_byte(data[i]);
-		}
-		i2c_send_stop();
-	}
+	i2c_transaction_t transaction = {
+		.device_address = device_address,
+		.use_register = TRUE,
+		.register_address = register_address,
+		.tx = data,
+		.tx_length = number_of_bytes,
+	};
+
+	i2c_submit(&transaction);
+	i2c_wait(&transaction);
 }
 
 void i2c_send_byte(uint8_t data){
@@ -198,4 +204,158 @@ u08 i2c_get_status_register()
 	return(inb(TWSR));
 }
 
+static u08 i2c_tx_length(i2c_transaction_t* transaction)
+{
+	return transaction->tx_length + (transaction->use_register ? 1 : 0);
+}
+
+//issues a start for the transaction at the head of the queue
+static void i2c_start_head(u08 twcr)
+{
+	i2c_index = 0;
+	i2c_state = i2c_tx_length(i2c_queue_head) ? I2C_MASTER_TX : I2C_MASTER_RX;
+	outb(TWCR, twcr);
+}
+
+//ends the transfer at the head of the queue and moves on to the next one
+static void i2c_finish(eI2cResultType result)
+{
+	i2c_transaction_t* done = i2c_queue_head;
+
+	i2c_queue_head = done->next;
+	if(i2c_queue_head == NULL)
+		i2c_queue_tail = NULL;
+
+	if(i2c_queue_head != NULL){
+		//stop followed by a start for the next transfer
+		i2c_start_head(I2C_TWCR_STOP|BV(TWSTA));
+	}else{
+		i2c_state = I2C_IDLE;
+		outb(TWCR, I2C_TWCR_STOP);
+	}
+
+	done->result = result;
+	if(done->callback != NULL)
+		done->callback(done);
+}
 
+u08 i2c_submit(i2c_transaction_t* transaction)
+{
+	u08 sreg = SREG;
+
+	//the ISR counts the register address and tx bytes in a u08, and a
+	//transfer with nothing to move would only address the device
+	if((transaction->use_register && transaction->tx_length == 255) ||
+			(!transaction->use_register && !transaction->tx_length &&
+			!transaction->rx_length)){
+		transaction->result = I2C_INVALID;
+		return FALSE;
+	}
+
+	transaction->result = I2C_PENDING;
+	transaction->next = NULL;
+
+	cli();
+
+	if(i2c_queue_head == NULL){
+		i2c_queue_head = transaction;
+		i2c_queue_tail = transaction;
+
+		//let the stop that ended the last transfer go out first
+		while(inb(TWCR) & BV(TWSTO));
+		i2c_start_head(I2C_TWCR_START);
+	}else{
+		i2c_queue_tail->next = transaction;
+		i2c_queue_tail = transaction;
+	}
+
+	SREG = sreg;
+
+	return TRUE;
+}
+
+u08 i2c_busy()
+{
+	return i2c_queue_head != NULL;
+}
+
+eI2cResultType i2c_wait(i2c_transaction_t* transaction)
+{
+	while(transaction->result == I2C_PENDING);
+
+	return transaction->result;
+}
+
+ISR(TWI_vect)
+{
+	i2c_transaction_t* transaction = i2c_queue_head;
+	u08 tx_length;
+
+	if(transaction == NULL){
+		//nothing queued, release the bus
+		outb(TWCR, I2C_TWCR_STOP);
+		return;
+	}
+
+	tx_length = i2c_tx_length(transaction);
+
+	switch(TW_STATUS){
+	case TW_START:
+	case TW_REP_START:
+		if(i2c_state == I2C_MASTER_TX)
+			outb(TWDR, transaction->device_address & 0xFE);
+		else
+			outb(TWDR, transaction->device_address | 0x01);
+		outb(TWCR, I2C_TWCR_RUN);
+		break;
+
+	case TW_MT_SLA_ACK:
+	case TW_MT_DATA_ACK:
+		if(i2c_index < tx_length){
+			if(transaction->use_register && i2c_index == 0)
+				outb(TWDR, transaction->register_address);
+			else
+				outb(TWDR, transaction->tx[i2c_index -
+						(transaction->use_register ? 1 : 0)]);
+			i2c_index++;
+			outb(TWCR, I2C_TWCR_RUN);
+		}else if(transaction->rx_length){
+			//repeated start, the bus is kept for the read
+			i2c_index = 0;
+			i2c_state = I2C_MASTER_RX;
+			outb(TWCR, I2C_TWCR_START);
+		}else
+			i2c_finish(I2C_DONE);
+		break;
+
+	case TW_MR_DATA_ACK:
+		transaction->rx[i2c_index++] = inb(TWDR);
+		//fall through
+	case TW_MR_SLA_ACK:
+		if(i2c_index + 1 < transaction->rx_length)
+			outb(TWCR, I2C_TWCR_ACK);
+		else if(i2c_index < transaction->rx_length)
+			//NACK the last byte
+			outb(TWCR, I2C_TWCR_RUN);
+		else
+			//zero length read
+			i2c_finish(I2C_DONE);
+		break;
+
+	case TW_MR_DATA_NACK:
+		transaction->rx[i2c_index++] = inb(TWDR);
+		i2c_finish(I2C_DONE);
+		break;
+
+	case TW_MT_SLA_NACK:
+	case TW_MT_DATA_NACK:
+	case TW_MR_SLA_NACK:
+		i2c_finish(I2C_NACK);
+		break;
+
+	default:
+		//bus error or lost arbitration
+		i2c_finish(I2C_BUS_ERROR);
+		break;
+	}
+}
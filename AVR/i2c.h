@@ -1,6 +1,8 @@
 #ifndef INCLUDE_I2C_H_
 #define INCLUDE_I2C_H_
 
+#include <stdint.h>
+
 #define u08		uint8_t
 #define u16		uint16_t
 
@@ -24,6 +26,12 @@
 #ifndef inw
 	#define	inw(addr)			(addr)
 #endif
+#ifndef TRUE
+	#define TRUE	1
+#endif
+#ifndef FALSE
+	#define FALSE	0
+#endif
 #ifndef BV
 	#define BV(bit)			(1<<(bit))
 #endif
@@ -42,6 +50,44 @@ typedef enum
 	I2C_SLAVE_TX = 4, I2C_SLAVE_RX = 5
 } eI2cStateType;
 
+typedef enum
+{
+	I2C_PENDING = 0,	//queued or on the bus
+	I2C_DONE,
+	I2C_NACK,			//address or data byte not acknowledged
+	I2C_BUS_ERROR,		//bus error or lost arbitration
+	I2C_INVALID			//rejected by i2c_submit, never queued
+} eI2cResultType;
+
+typedef struct i2c_transaction i2c_transaction_t;
+
+typedef void (*i2c_callback_t)(i2c_transaction_t* transaction);
+
+/*
+ * One transfer to one device: an optional register address and tx bytes
+ * are written, then, after a repeated start, rx bytes are read. Either
+ * part may be empty, but not both, and the register address and tx bytes
+ * together are at most 255 bytes. The transaction and its buffers belong
+ * to the caller
+ * and must stay valid until result leaves I2C_PENDING.
+ */
+struct i2c_transaction
+{
+	u08 device_address;		//8 bit address, the R/W bit is ignored
+	u08 use_register;		//send register_address before tx
+	u08 register_address;
+	u08* tx;
+	u08 tx_length;
+	u08* rx;
+	u08 rx_length;
+
+	i2c_callback_t callback;	//called from the TWI interrupt, may be NULL
+	void* context;
+
+	volatile eI2cResultType result;
+	i2c_transaction_t* next;
+};
+
 void i2c_init();
 void i2c_set_local_device_addr(u08 deviceAddr);
 void i2c_set_bitrate(uint16_t bitrateKHz);
@@ -58,5 +104,24 @@ void i2c_send_byte(uint8_t data);
 u08 i2c_get_received_byte();
 u08 i2c_receive_byte_to_register_w_ack();
 u08 i2c_receive_byte_to_register_wo_ack();
+void i2c_send_stop();
+u08 i2c_send_start(u08 device_address, u08 read);
+u08 i2c_get_status_register();
+
+/*
+ * Interrupt driven transfers. i2c_submit queues the transaction and
+ * returns at once, the TWI interrupt runs the queue in order and calls
+ * each transaction's callback when it finishes. A transaction that moves
+ * no bytes or writes more than 255 is not queued, its result is set to
+ * I2C_INVALID, its callback is not called and i2c_submit returns FALSE. Callbacks may submit
+ * further transactions. i2c_read_bytes and i2c_write_bytes are built on
+ * the queue and wait for their transfer, so they need global interrupts
+ * enabled and must not be called from an interrupt. The single step
+ * functions above poll the hardware and must not be mixed with queued
+ * transfers.
+ */
+u08 i2c_submit(i2c_transaction_t* transaction);
+u08 i2c_busy();
+eI2cResultType i2c_wait(i2c_transaction_t* transaction);
 
 #endif /* INCLUDE_I2C_ALEX_H_ */
@@ -0,0 +1,211 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Host check and benchmark of the shared RTC codec
+ *	
+ * Checks the BCD conversions against the divide and modulo versions the
+ * drivers used before, the calendar conversions against gmtime from
+ * 1970 to 2100 and the next alarm date match against a walk over the
+ * days, then times each against the code it replaces. The
+ * divide and modulo versions are kept out of line so that the compiler
+ * does not fold them into the loops.
+ *
+ * Build and run from the Common directory:
+ *	gcc -O2 -Wall -Wextra -I. host/rtc_codec_bench.c rtc_codec.c \
+ *		-o rtc_codec_bench
+ *	./rtc_codec_bench
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "rtc_codec.h"
+
+#define BCD_LOOPS		50000000
+#define CALENDAR_LOOPS	2000000
+
+//the conversions the DS1307 and DS3231 drivers carried before the codec
+__attribute__((noinline)) static uint8_t old_dec2bcd(uint8_t d)
+{
+	return ((d / 10 * 16) + (d % 10));
+}
+
+__attribute__((noinline)) static uint8_t old_bcd2dec(uint8_t b)
+{
+	return ((b / 16 * 10) + (b % 16));
+}
+
+__attribute__((noinline)) static uint8_t new_dec2bcd(uint8_t d)
+{
+	return rtc_dec2bcd(d);
+}
+
+__attribute__((noinline)) static uint8_t new_bcd2dec(uint8_t b)
+{
+	return rtc_bcd2dec(b);
+}
+
+static double now_ns(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static uint32_t check(void)
+{
+	uint32_t bad = 0, t, match, next, day;
+	uint8_t d, raw[RTC_BCD_TIME_SIZE];
+	time_t tt;
+	struct tm g;
+	rtc_datetime_t r, back;
+
+	for(d = 0; d < 100; d++)
+		if(rtc_dec2bcd(d) != old_dec2bcd(d) ||
+				rtc_bcd2dec(old_dec2bcd(d)) != d)
+			bad++;
+
+	for(t = 0; t < 4102444800u; t += 3593){
+		tt = t;
+		gmtime_r(&tt, &g);
+		rtc_from_epoch(t, &r);
+		if(r.year != g.tm_year + 1900 || r.month != g.tm_mon + 1 ||
+				r.date != g.tm_mday || r.hour != g.tm_hour ||
+				r.min != g.tm_min || r.sec != g.tm_sec ||
+				r.week_day != (g.tm_wday ? g.tm_wday : 7))
+			bad++;
+		if(rtc_to_epoch(&r) != t)
+			bad++;
+
+		//the registers only hold 2000 to 2099
+		if(r.year >= 2000){
+			rtc_encode_bcd_time(&r, raw);
+			rtc_decode_bcd_time(raw, &back);
+			if(rtc_to_epoch(&back) != t || back.week_day != r.week_day)
+				bad++;
+		}
+	}
+
+	//the next date match against a walk over the following days
+	for(t = 946684800u; t < 4102444800u - 200 * RTC_SECONDS_PER_DAY;
+			t += 86399 * 3 + 7){
+		match = t + (t / 7) % (130 * RTC_SECONDS_PER_DAY);
+		rtc_from_epoch(match, &r);
+		for(day = t / RTC_SECONDS_PER_DAY; ; day++){
+			next = day * RTC_SECONDS_PER_DAY + match % RTC_SECONDS_PER_DAY;
+			rtc_from_epoch(next, &back);
+			if(next > t && back.date == r.date)
+				break;
+		}
+		if(rtc_next_date_match(t, match) != next)
+			bad++;
+	}
+
+	return bad;
+}
+
+int main(void)
+{
+	volatile uint32_t sink = 0;
+	double t0, old_enc, new_enc, old_dec, new_dec;
+	double mk, to, gm, from;
+	rtc_datetime_t r;
+	struct tm tm, g;
+	time_t tt;
+	uint32_t bad;
+	int i;
+
+	bad = check();
+	printf("mismatches %u\n", bad);
+
+	t0 = now_ns();
+	for(i = 0; i < BCD_LOOPS; i++)
+		sink += old_dec2bcd(i % 100);
+	old_enc = (now_ns() - t0) / BCD_LOOPS;
+	t0 = now_ns();
+	for(i = 0; i < BCD_LOOPS; i++)
+		sink += new_dec2bcd(i % 100);
+	new_enc = (now_ns() - t0) / BCD_LOOPS;
+	t0 = now_ns();
+	for(i = 0; i < BCD_LOOPS; i++)
+		sink += old_bcd2dec(i & 0x99);
+	old_dec = (now_ns() - t0) / BCD_LOOPS;
+	t0 = now_ns();
+	for(i = 0; i < BCD_LOOPS; i++)
+		sink += new_bcd2dec(i & 0x99);
+	new_dec = (now_ns() - t0) / BCD_LOOPS;
+
+	printf("dec2bcd: divide %.2f ns, codec %.2f ns\n", old_enc, new_enc);
+	printf("bcd2dec: divide %.2f ns, codec %.2f ns\n", old_dec, new_dec);
+
+	//mktime works in local time, make that UTC for a fair comparison
+	setenv("TZ", "UTC", 1);
+	tzset();
+
+	t0 = now_ns();
+	for(i = 0; i < CALENDAR_LOOPS; i++){
+		tm = (struct tm){0};
+		tm.tm_year = 117 + i % 80;
+		tm.tm_mon = i % 12;
+		tm.tm_mday = 1 + i % 28;
+		tm.tm_hour = i % 24;
+		tm.tm_min = i % 60;
+		tm.tm_sec = i % 60;
+		sink += mktime(&tm);
+	}
+	mk = (now_ns() - t0) / CALENDAR_LOOPS;
+	t0 = now_ns();
+	for(i = 0; i < CALENDAR_LOOPS; i++){
+		r.year = 2017 + i % 80;
+		r.month = 1 + i % 12;
+		r.date = 1 + i % 28;
+		r.hour = i % 24;
+		r.min = i % 60;
+		r.sec = i % 60;
+		sink += rtc_to_epoch(&r);
+	}
+	to = (now_ns() - t0) / CALENDAR_LOOPS;
+	t0 = now_ns();
+	for(i = 0; i < CALENDAR_LOOPS; i++){
+		tt = 1500000000u + i * 7919u;
+		gmtime_r(&tt, &g);
+		sink += g.tm_mday;
+	}
+	gm = (now_ns() - t0) / CALENDAR_LOOPS;
+	t0 = now_ns();
+	for(i = 0; i < CALENDAR_LOOPS; i++){
+		rtc_from_epoch(1500000000u + i * 7919u, &r);
+		sink += r.date;
+	}
+	from = (now_ns() - t0) / CALENDAR_LOOPS;
+
+	printf("to epoch: mktime %.1f ns, rtc_to_epoch %.1f ns\n", mk, to);
+	printf("from epoch: gmtime_r %.1f ns, rtc_from_epoch %.1f ns\n", gm, from);
+
+	(void)sink;
+	return bad != 0;
+}
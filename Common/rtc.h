@@ -0,0 +1,116 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Common interface to the RTC libraries
+ *	
+ * One set of functions for the DS3231 (STM32), DS1307 (STM32) and DS3231
+ * (AVR) libraries. The chip is chosen at link time by compiling exactly
+ * one backend next to the library it wraps:
+ *
+ *	DS3231 STM32	STM32/Tested and working/DS3231/DS3231_rtc.c
+ *	DS1307 STM32	STM32/Untested/DS1307/DS1307_rtc.c
+ *	DS3231 AVR		AVR/ds3231_rtc.c
+ *
+ * Calls go straight to the backend, there is no table of function
+ * pointers, and each backend converts directly between the chip's BCD
+ * registers and rtc_datetime_t. Features a chip does not have return
+ * RTC_ERR_UNSUPPORTED. Times are 24 hour, the backends switch the chip
+ * to 24 hour mode when the time is set.
+ *
+ * Usage:
+ *	rtc_init(&hi2c2);	//NULL on AVR, which has a single bus
+ *	rtc_get_epoch(&now);
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef RTC_H_
+#define RTC_H_
+
+#include <stdint.h>
+
+#include "rtc_codec.h"
+
+typedef enum {
+	RTC_OK = 0,
+	RTC_ERR_BUS,			/*!< I2C transfer failed */
+	RTC_ERR_UNSUPPORTED,	/*!< The chip does not have the feature */
+	RTC_ERR_RANGE			/*!< Argument outside of what the chip can hold */
+} rtc_err_t;
+
+/**
+ * @brief Selects the bus the RTC is on
+ *
+ * @param bus - eg. I2C_HandleTypeDef* on STM32, ignored on AVR
+ **/
+rtc_err_t rtc_init(void* bus);
+
+rtc_err_t rtc_get_datetime(rtc_datetime_t* datetime);
+
+/**
+ * @brief Sets the time, years 2000 to 2099
+ **/
+rtc_err_t rtc_set_datetime(const rtc_datetime_t* datetime);
+
+/**
+ * @brief Seconds since 1970-01-01 00:00:00
+ **/
+rtc_err_t rtc_get_epoch(uint32_t* epoch);
+rtc_err_t rtc_set_epoch(uint32_t epoch);
+
+/**
+ * @brief Sets the hardware alarm to fire at the given time
+ *
+ * The alarm matches the date, hour, minute and second, not the month or
+ * year. An epoch that is not in the future, or that lies beyond the next
+ * time its date and time come round (eg. more than a month ahead), would
+ * fire at the wrong time and is refused with RTC_ERR_RANGE; wait and set
+ * it again closer to the time. Once it has fired the alarm goes off again
+ * on that date of every following month until rtc_clear_alarm is called,
+ * so call rtc_clear_alarm after it has fired for a one-shot alarm.
+ **/
+rtc_err_t rtc_set_alarm(uint32_t epoch);
+
+/**
+ * @brief Disables the alarm and clears its flag
+ **/
+rtc_err_t rtc_clear_alarm(void);
+
+/**
+ * @brief Returns 1 in fired if the alarm has gone off since it was set
+ **/
+rtc_err_t rtc_alarm_fired(uint8_t* fired);
+
+/**
+ * @brief Temperature in quarter degrees Celsius
+ **/
+rtc_err_t rtc_get_temperature(int16_t* quarter_degrees);
+
+/**
+ * @brief Bytes of battery backed RAM, 0 if there is none
+ **/
+uint8_t rtc_sram_size(void);
+
+rtc_err_t rtc_read_sram(uint8_t offset, uint8_t* data, uint8_t length);
+rtc_err_t rtc_write_sram(uint8_t offset, const uint8_t* data, uint8_t length);
+
+#endif /* RTC_H_ */
@@ -0,0 +1,158 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   BCD and calendar conversions shared by the RTC libraries
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+
+#include "rtc_codec.h"
+
+//days from 0000-03-01 to 1970-01-01
+#define RTC_EPOCH_DAYS		719468ul
+#define RTC_DAYS_PER_ERA	146097ul
+
+int32_t rtc_days_from_civil(uint16_t year, uint8_t month, uint8_t date)
+{
+	//years start in March so that the leap day is the last day of the year
+	uint32_t y = (uint32_t)year - (month <= 2);
+	uint32_t era = y / 400;
+	uint32_t year_of_era = y - era * 400;
+	uint32_t month_from_march = (month > 2) ? month - 3 : month + 9;
+	uint32_t day_of_year = (153 * month_from_march + 2) / 5 + date - 1;
+	uint32_t day_of_era = year_of_era * 365 + year_of_era / 4 -
+			year_of_era / 100 + day_of_year;
+
+	return (int32_t)(era * RTC_DAYS_PER_ERA + day_of_era) - (int32_t)RTC_EPOCH_DAYS;
+}
+
+void rtc_civil_from_days(uint32_t days, rtc_datetime_t* datetime)
+{
+	uint32_t z = days + RTC_EPOCH_DAYS;
+	uint32_t era = z / RTC_DAYS_PER_ERA;
+	uint32_t day_of_era = z - era * RTC_DAYS_PER_ERA;
+	uint32_t year_of_era = (day_of_era - day_of_era / 1460 +
+			day_of_era / 36524 - day_of_era / 146096) / 365;
+	uint32_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 -
+			year_of_era / 100);
+	uint32_t month_from_march = (5 * day_of_year + 2) / 153;
+	uint8_t month = (month_from_march < 10) ? month_from_march + 3 :
+			month_from_march - 9;
+
+	datetime->date = day_of_year - (153 * month_from_march + 2) / 5 + 1;
+	datetime->month = month;
+	datetime->year = year_of_era + era * 400 + (month <= 2);
+	datetime->week_day = (days + RTC_EPOCH_WEEK_DAY - 1) % 7 + 1;
+}
+
+uint32_t rtc_to_epoch(const rtc_datetime_t* datetime)
+{
+	uint32_t days = (uint32_t)rtc_days_from_civil(datetime->year,
+			datetime->month, datetime->date);
+
+	return days * RTC_SECONDS_PER_DAY + datetime->hour * 3600ul +
+			datetime->min * 60u + datetime->sec;
+}
+
+void rtc_from_epoch(uint32_t epoch, rtc_datetime_t* datetime)
+{
+	uint32_t days = epoch / RTC_SECONDS_PER_DAY;
+	uint32_t seconds = epoch - days * RTC_SECONDS_PER_DAY;
+	uint16_t minutes = seconds / 60;
+
+	datetime->sec = seconds - minutes * 60u;
+	datetime->hour = minutes / 60;
+	datetime->min = minutes - datetime->hour * 60u;
+
+	rtc_civil_from_days(days, datetime);
+}
+
+uint32_t rtc_next_date_match(uint32_t now, uint32_t match)
+{
+	rtc_datetime_t today, target;
+	uint32_t time_of_day = match % RTC_SECONDS_PER_DAY;
+	uint32_t candidate;
+	int32_t month_days;
+	uint16_t year;
+	uint8_t month, i;
+
+	rtc_from_epoch(now, &today);
+	rtc_from_epoch(match, &target);
+	year = today.year;
+	month = today.month;
+
+	//no date is missing from two months in a row, so the match is in this
+	//month or one of the next two
+	for(i = 0; i < 3; i++){
+		month_days = (month == 12) ? 31 : rtc_days_from_civil(year, month + 1, 1) -
+				rtc_days_from_civil(year, month, 1);
+
+		if(target.date <= month_days){
+			candidate = (uint32_t)rtc_days_from_civil(year, month, target.date) *
+					RTC_SECONDS_PER_DAY + time_of_day;
+			if(candidate > now)
+				return candidate;
+		}
+
+		if(++month > 12){
+			month = 1;
+			year++;
+		}
+	}
+
+	return match;
+}
+
+void rtc_decode_bcd_time(const uint8_t* raw, rtc_datetime_t* datetime)
+{
+	uint8_t hour = raw[2];
+
+	datetime->sec = rtc_bcd2dec(raw[0] & 0x7F);
+	datetime->min = rtc_bcd2dec(raw[1] & 0x7F);
+
+	if(hour & RTC_BCD_TWELVE_HOUR)
+		//12 AM is midnight, 12 PM noon
+		datetime->hour = rtc_bcd2dec(hour & 0x1F) % 12 +
+				((hour & RTC_BCD_PM) ? 12 : 0);
+	else
+		datetime->hour = rtc_bcd2dec(hour & 0x3F);
+
+	datetime->week_day = raw[3] & 0x07;
+	datetime->date = rtc_bcd2dec(raw[4] & 0x3F);
+	datetime->month = rtc_bcd2dec(raw[5] & 0x1F);
+	datetime->year = 2000 + rtc_bcd2dec(raw[6]);
+}
+
+void rtc_encode_bcd_time(const rtc_datetime_t* datetime, uint8_t* raw)
+{
+	int32_t days = rtc_days_from_civil(datetime->year, datetime->month,
+			datetime->date);
+
+	raw[0] = rtc_dec2bcd(datetime->sec);
+	raw[1] = rtc_dec2bcd(datetime->min);
+	raw[2] = rtc_dec2bcd(datetime->hour);
+	raw[3] = (uint8_t)((days + RTC_EPOCH_WEEK_DAY - 1) % 7 + 1);
+	raw[4] = rtc_dec2bcd(datetime->date);
+	raw[5] = rtc_dec2bcd(datetime->month);
+	raw[6] = rtc_dec2bcd(datetime->year % 100);
+}
@@ -0,0 +1,134 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   BCD and calendar conversions shared by the RTC libraries
+ *	
+ * BCD conversion uses a multiply and shift instead of a divide and modulo,
+ * and the calendar conversions use Howard Hinnant's days from civil
+ * algorithm, which only needs divisions by constants and no tables, so
+ * no libc time functions (mktime, gmtime) are linked in. Dates are in the
+ * proleptic Gregorian calendar, epoch seconds are counted from
+ * 1970-01-01 00:00:00 and are valid up to 2106.
+ *
+ * Add this directory to the include path of projects using the DS3231 or
+ * DS1307 libraries and compile rtc_codec.c with them.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef RTC_CODEC_H_
+#define RTC_CODEC_H_
+
+#include <stdint.h>
+
+#define RTC_SECONDS_PER_DAY		86400ul
+
+/** Day of the week of 1970-01-01, a Thursday, counting Monday as 1 */
+#define RTC_EPOCH_WEEK_DAY		4
+
+/** Seconds to year registers of the DS1307/DS3231 */
+#define RTC_BCD_TIME_SIZE		7
+
+//hour register flags
+#define RTC_BCD_TWELVE_HOUR		0x40
+#define RTC_BCD_PM				0x20
+
+typedef struct {
+	uint16_t year;		/*!< eg. 2017 */
+	uint8_t month;		/*!< 1-12 */
+	uint8_t date;		/*!< 1-31 */
+	uint8_t week_day;	/*!< 1-7, Monday is 1 */
+	uint8_t hour;		/*!< 0-23 */
+	uint8_t min;
+	uint8_t sec;
+} rtc_datetime_t;
+
+/**
+ * @brief Converts 0-99 to packed BCD
+ **/
+static inline uint8_t rtc_dec2bcd(uint8_t d)
+{
+	//(d * 205) >> 11 is d / 10 for d < 1029
+	return d + (uint8_t)((d * 205) >> 11) * 6;
+}
+
+/**
+ * @brief Converts packed BCD to 0-99
+ **/
+static inline uint8_t rtc_bcd2dec(uint8_t b)
+{
+	//every ten counts 16 in BCD
+	return b - (b >> 4) * 6;
+}
+
+/**
+ * @brief Days since 1970-01-01 of a date
+ **/
+int32_t rtc_days_from_civil(uint16_t year, uint8_t month, uint8_t date);
+
+/**
+ * @brief Date of a number of days since 1970-01-01
+ *
+ * @param days - Days since 1970-01-01, not negative
+ * @param datetime - The year, month, date and week_day are set
+ **/
+void rtc_civil_from_days(uint32_t days, rtc_datetime_t* datetime);
+
+/**
+ * @brief Seconds since 1970-01-01 00:00:00 of a date and time
+ **/
+uint32_t rtc_to_epoch(const rtc_datetime_t* datetime);
+
+/**
+ * @brief Date and time of a number of seconds since 1970-01-01 00:00:00
+ **/
+void rtc_from_epoch(uint32_t epoch, rtc_datetime_t* datetime);
+
+/**
+ * @brief First time after now with the same date, hour, minute and second
+ * as match, when an alarm that ignores the month and year goes off
+ *
+ * Months without that date are skipped.
+ **/
+uint32_t rtc_next_date_match(uint32_t now, uint32_t match);
+
+/**
+ * @brief Decodes the seconds to year registers of a DS1307 or DS3231
+ *
+ * 12 hour times are converted to 24 hour, the clock halt and century bits
+ * are ignored and the year is taken to be 2000 to 2099.
+ *
+ * @param raw - RTC_BCD_TIME_SIZE registers starting at seconds
+ **/
+void rtc_decode_bcd_time(const uint8_t* raw, rtc_datetime_t* datetime);
+
+/**
+ * @brief Encodes a date and time into the seconds to year registers
+ *
+ * The hour is written in 24 hour mode and the day of the week is
+ * calculated from the date.
+ *
+ * @param raw - RTC_BCD_TIME_SIZE registers starting at seconds
+ **/
+void rtc_encode_bcd_time(const rtc_datetime_t* datetime, uint8_t* raw);
+
+#endif /* RTC_CODEC_H_ */
@@ -95,7 +95,7 @@ BH1750_device_t* BH1750_init_dev_struct(I2C_HandleTypeDef* i2c_handle,
 		init->address_w = BH1750_NO_GROUND_ADDR_WRITE;
 	}
 
-	init->name = (char*)malloc(sizeof(char) * strlen(name));
+	init->name = (char*)malloc(sizeof(char) * (strlen(name) + 1));
 
 	if(init->name == NULL) return NULL;
 
@@ -103,6 +103,13 @@ BH1750_device_t* BH1750_init_dev_struct(I2C_HandleTypeDef* i2c_handle,
 
 	strcpy(init->name, name);
 
+	init->mode = CMD_H_RES_MODE;
+	init->mtreg = BH1750_MTREG_DEFAULT;
+	init->lux_scale = ((BH1750_LUX_Q16_FACTOR << 8) + BH1750_MTREG_DEFAULT / 2) /
+			BH1750_MTREG_DEFAULT;
+
+	BH1750_filter_init(&init->filter);
+
 	init->poll = &BH1750_poll_self;
 
 	return init;
@@ -112,7 +119,7 @@ HAL_StatusTypeDef BH1750_init_dev(BH1750_device_t* dev)
 {
 	BH1750_send_command(dev, CMD_POWER_ON);
 	BH1750_send_command(dev, CMD_RESET);
-	BH1750_send_command(dev, CMD_H_RES_MODE);
+	BH1750_send_command(dev, dev->mode);
 
 	return HAL_OK;
 }
@@ -131,18 +138,137 @@ HAL_StatusTypeDef BH1750_read_dev(BH1750_device_t* dev)
 
 HAL_StatusTypeDef BH1750_convert(BH1750_device_t* dev)
 {
-	dev->value = dev->buffer[0];
-	dev->value = (dev->value << 8) | dev->buffer[1];
+	uint64_t lux;
+
+	dev->raw = ((uint16_t)dev->buffer[0] << 8) | dev->buffer[1];
+
+	//32x32 multiply, no division or float, lux in Q24
+	lux = (uint64_t)dev->raw * dev->lux_scale;
+
+	//mode 2 counts twice per lux
+	if((dev->mode & 0x0F) == (CMD_H_RES_MODE2 & 0x0F))
+		lux >>= 1;
 
-	//TODO check float stuff
-	dev->value/=1.2;
+	//Q24.8 holds the whole range, 65535 counts at MTreg 31 is 121557 lx
+	dev->lux_q8 = (uint32_t)((lux + 0x8000) >> 16);
+
+	//rounded from lux_q8 so that the two never disagree
+	dev->value = (dev->lux_q8 + 0x80) >> 8;
+
+	BH1750_filter_push(&dev->filter, dev->lux_q8);
 
 	return HAL_OK;
 }
 
+uint32_t BH1750_conversion_ms(BH1750_device_t* dev)
+{
+	uint32_t max_ms;
+
+	switch(dev->mode){
+	case CMD_L_RES_MODE:
+	case CMD_ONE_L_RES_MODE:
+		max_ms = BH1750_L_RES_MAX_MS;
+		break;
+	default:
+		max_ms = BH1750_H_RES_MAX_MS;
+		break;
+	}
+
+	//rounded up so that the result is always ready
+	return (max_ms * dev->mtreg + BH1750_MTREG_DEFAULT - 1) / BH1750_MTREG_DEFAULT;
+}
+
+HAL_StatusTypeDef BH1750_set_mode(BH1750_device_t* dev, uint8_t mode)
+{
+	dev->mode = mode;
+
+	return BH1750_send_command(dev, mode);
+}
+
+HAL_StatusTypeDef BH1750_set_mtreg(BH1750_device_t* dev, uint8_t mtreg)
+{
+	if(mtreg < BH1750_MTREG_MIN)
+		mtreg = BH1750_MTREG_MIN;
+	if(mtreg > BH1750_MTREG_MAX)
+		mtreg = BH1750_MTREG_MAX;
+
+	if(BH1750_send_command(dev, CMD_CNG_TIME_HIGH | (mtreg >> 5)) != HAL_OK)
+		return HAL_ERROR;
+	if(BH1750_send_command(dev, CMD_CNG_TIME_LOW | (mtreg & 0x1F)) != HAL_OK)
+		return HAL_ERROR;
+
+	dev->mtreg = mtreg;
+	dev->lux_scale = ((BH1750_LUX_Q16_FACTOR << 8) + mtreg / 2) / mtreg;
+
+	return HAL_OK;
+}
+
+//MTreg that brings count to BH1750_AUTO_COUNT_TARGET, clamped
+static uint8_t BH1750_auto_mtreg(BH1750_device_t* dev)
+{
+	uint32_t mtreg = ((uint32_t)dev->mtreg * BH1750_AUTO_COUNT_TARGET) /
+			(dev->raw ? dev->raw : 1);
+
+	if(mtreg < BH1750_MTREG_MIN)
+		return BH1750_MTREG_MIN;
+	if(mtreg > BH1750_MTREG_MAX)
+		return BH1750_MTREG_MAX;
+
+	return mtreg;
+}
+
+bool BH1750_autorange(BH1750_device_t* dev)
+{
+	//keep one time or continuous as chosen, only the resolution changes
+	uint8_t one_time = dev->mode & 0x20;
+	uint8_t resolution = dev->mode & 0x0F;
+	uint8_t mtreg = dev->mtreg;
+	uint8_t mode;
+	uint32_t lux = dev->lux_q8 >> 8;
+
+	if(resolution != (CMD_L_RES_MODE & 0x0F) && lux > BH1750_AUTO_L_LUX){
+		//bright, 4 lx steps in a measurement 7.5 times shorter
+		resolution = CMD_L_RES_MODE & 0x0F;
+		mtreg = BH1750_MTREG_DEFAULT;
+	}else if(resolution == (CMD_L_RES_MODE & 0x0F) && lux < BH1750_AUTO_H_LUX){
+		resolution = CMD_H_RES_MODE & 0x0F;
+		mtreg = BH1750_MTREG_DEFAULT;
+	}else if(resolution == (CMD_H_RES_MODE & 0x0F) && lux < BH1750_AUTO_DARK_LUX){
+		//dark, 0.11 lx steps
+		resolution = CMD_H_RES_MODE2 & 0x0F;
+		mtreg = BH1750_MTREG_MAX;
+	}else if(resolution == (CMD_H_RES_MODE2 & 0x0F) && lux > BH1750_AUTO_DIM_LUX){
+		resolution = CMD_H_RES_MODE & 0x0F;
+		mtreg = BH1750_MTREG_DEFAULT;
+	}else if(dev->raw > BH1750_AUTO_COUNT_HIGH){
+		//close to saturating, shorter measurements reach 100000 lx
+		mtreg = BH1750_auto_mtreg(dev);
+	}else if(dev->raw < BH1750_AUTO_COUNT_LOW && mtreg < BH1750_MTREG_DEFAULT){
+		//back to the default once the light has dropped
+		mtreg = BH1750_auto_mtreg(dev);
+		if(mtreg > BH1750_MTREG_DEFAULT)
+			mtreg = BH1750_MTREG_DEFAULT;
+	}
+
+	mode = (one_time ? 0x20 : 0x10) | resolution;
+
+	if(mtreg == dev->mtreg && mode == dev->mode)
+		return false;
+
+	if(mtreg != dev->mtreg && BH1750_set_mtreg(dev, mtreg) != HAL_OK)
+		return false;
+
+	//restart so the next result is all at the new settings
+	BH1750_set_mode(dev, mode);
+
+	return true;
+}
+
 HAL_StatusTypeDef BH1750_get_lumen(BH1750_device_t* dev)
 {
 	BH1750_read_dev(dev);
 	BH1750_convert(dev);
+	if(dev->autorange)
+		BH1750_autorange(dev);
 	return HAL_OK;
 }
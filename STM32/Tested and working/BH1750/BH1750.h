@@ -28,10 +28,13 @@
 #ifndef BH1750_H_
 #define BH1750_H_
 
+#include "BH1750_filter.h"
+
 //Device Address
 //Please note that arduino uses 7 bit addresses, STM32 uses 8
-#define BH1750_NO_GROUND_ADDR_WRITE     (0xB9 + 0)
-#define BH1750_NO_GROUND_ADDR_READ      (0xB9 + 1)
+//ADDR high is 0x5C, ADDR low is 0x23
+#define BH1750_NO_GROUND_ADDR_WRITE     (0xB8 + 0)
+#define BH1750_NO_GROUND_ADDR_READ      (0xB8 + 1)
 #define BH1750_GROUND_ADDR_WRITE        (0x46 + 0)
 #define BH1750_GROUND_ADDR_READ     (0x46 + 1)
 
@@ -46,9 +49,32 @@
 #define CMD_ONE_H_RES_MODE      0x20
 #define CMD_ONE_H_RES_MODE2     0x21
 #define CMD_ONE_L_RES_MODE      0x23
-#define CMD_CNG_TIME_HIGH       0x30    // 3 LSB set time
+#define CMD_CNG_TIME_HIGH       0x40    // 3 LSB set time
 #define CMD_CNG_TIME_LOW        0x60    // 5 LSB set time
 
+//longest measurement times at the default MTreg, datasheet p2
+#define BH1750_H_RES_MAX_MS     180
+#define BH1750_L_RES_MAX_MS     24
+
+//measurement time register, sensitivity and time scale with MTreg / 69
+#define BH1750_MTREG_MIN        31
+#define BH1750_MTREG_DEFAULT    69
+#define BH1750_MTREG_MAX        254
+
+//lux = count / 1.2 * 69 / MTreg, as Q16 this is count * 3768320 / MTreg
+#define BH1750_LUX_Q16_FACTOR   3768320UL
+
+//auto-range, H mode 2 at the longest MTreg below DARK_LUX until DIM_LUX,
+//L mode above L_LUX until H_LUX, H mode between
+#define BH1750_AUTO_DARK_LUX        10
+#define BH1750_AUTO_DIM_LUX         20
+#define BH1750_AUTO_H_LUX           1000
+#define BH1750_AUTO_L_LUX           2000
+//MTreg is shortened when the count passes HIGH, down to the count TARGET
+#define BH1750_AUTO_COUNT_HIGH      60000
+#define BH1750_AUTO_COUNT_LOW       8000
+#define BH1750_AUTO_COUNT_TARGET    30000
+
 #ifndef bool
 #define bool    uint8_t
 #endif
@@ -69,11 +95,19 @@ struct BH1750_device{
     uint8_t address_r;
     uint8_t address_w;
 
-    uint16_t value;
+    uint32_t value;     //lux, lux_q8 rounded
+    uint32_t lux_q8;    //lux in Q24.8, up to 121557 at the shortest MTreg
+    uint16_t raw;       //count of the last measurement
 
     uint8_t buffer[2];
 
-    uint8_t mode;
+    uint8_t mode;       //measurement command, CMD_H_RES_MODE by default
+    uint8_t mtreg;      //measurement time register, BH1750_MTREG_DEFAULT by default
+    uint32_t lux_scale; //lux per count in Q24, (BH1750_LUX_Q16_FACTOR << 8) / mtreg
+
+    bool autorange;     //steer mode and MTreg from each result
+
+    BH1750_filter_t filter;     //recent readings, fed by BH1750_convert
 
     void (* poll)(BH1750_device_t*);
 } ;
@@ -84,5 +118,11 @@ BH1750_device_t* BH1750_init_dev_struct(I2C_HandleTypeDef* i2c_handle,
         char* name, bool addr_grounded);
 HAL_StatusTypeDef BH1750_init_dev(BH1750_device_t* dev);
 HAL_StatusTypeDef BH1750_get_lumen(BH1750_device_t* dev);
+HAL_StatusTypeDef BH1750_send_command(BH1750_device_t* dev, uint8_t cmd);
+HAL_StatusTypeDef BH1750_convert(BH1750_device_t* dev);
+uint32_t BH1750_conversion_ms(BH1750_device_t* dev);
+HAL_StatusTypeDef BH1750_set_mode(BH1750_device_t* dev, uint8_t mode);
+HAL_StatusTypeDef BH1750_set_mtreg(BH1750_device_t* dev, uint8_t mtreg);
+bool BH1750_autorange(BH1750_device_t* dev);
 
 #endif /* BH1750_H_ */
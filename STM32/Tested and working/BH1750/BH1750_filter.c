@@ -0,0 +1,237 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Streaming filters over the recent readings of a BH1750
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include "BH1750_filter.h"
+
+#define HEAP(f)         ((f)->heap_buf + BH1750_FILTER_SIZE / 2)
+//readings in the min heap and in the max heap, the median is the rest
+#define MIN_COUNT(f)    (((f)->count - 1) / 2)
+#define MAX_COUNT(f)    ((f)->count / 2)
+
+void BH1750_filter_init(BH1750_filter_t* filter)
+{
+	int8_t* pos = filter->pos;
+	uint8_t* heap = HEAP(filter);
+	int8_t i;
+
+	filter->head = 0;
+	filter->count = 0;
+	filter->total = 0;
+	filter->ema = 0;
+	filter->min_first = filter->min_count = 0;
+	filter->max_first = filter->max_count = 0;
+
+	//slots fill the heap positions 0, -1, 1, -2, 2... as the ring fills
+	for(i = BH1750_FILTER_SIZE - 1; i >= 0; i--){
+		pos[i] = ((i + 1) / 2) * ((i & 1) ? -1 : 1);
+		heap[pos[i]] = i;
+		filter->samples[i] = 0;
+	}
+}
+
+static uint8_t heap_less(BH1750_filter_t* filter, int8_t i, int8_t j)
+{
+	uint8_t* heap = HEAP(filter);
+
+	return filter->samples[heap[i]] < filter->samples[heap[j]];
+}
+
+//swaps heap entries i and j if i < j
+static uint8_t heap_order(BH1750_filter_t* filter, int8_t i, int8_t j)
+{
+	uint8_t* heap = HEAP(filter);
+	uint8_t slot;
+
+	if(!heap_less(filter, i, j))
+		return 0;
+
+	slot = heap[i];
+	heap[i] = heap[j];
+	heap[j] = slot;
+	filter->pos[heap[i]] = i;
+	filter->pos[heap[j]] = j;
+
+	return 1;
+}
+
+//restores the min heap from entry i down, i is compared with i / 2
+static void min_sort_down(BH1750_filter_t* filter, int8_t i)
+{
+	for(; i <= MIN_COUNT(filter); i *= 2){
+		//1 and -1 both hang off the median, 1 has no sibling
+		if(i > 1 && i < MIN_COUNT(filter) && heap_less(filter, i + 1, i))
+			i++;
+		if(!heap_order(filter, i, i / 2))
+			break;
+	}
+}
+
+static void max_sort_down(BH1750_filter_t* filter, int8_t i)
+{
+	for(; i >= -MAX_COUNT(filter); i *= 2){
+		if(i < -1 && i > -MAX_COUNT(filter) && heap_less(filter, i, i - 1))
+			i--;
+		if(!heap_order(filter, i / 2, i))
+			break;
+	}
+}
+
+//returns 1 if the entry made it to the median
+static uint8_t min_sort_up(BH1750_filter_t* filter, int8_t i)
+{
+	while(i > 0 && heap_order(filter, i, i / 2))
+		i /= 2;
+
+	return i == 0;
+}
+
+static uint8_t max_sort_up(BH1750_filter_t* filter, int8_t i)
+{
+	while(i < 0 && heap_order(filter, i / 2, i))
+		i /= 2;
+
+	return i == 0;
+}
+
+static void BH1750_filter_median_update(BH1750_filter_t* filter, uint8_t slot,
+		uint32_t old, uint8_t full)
+{
+	uint32_t value = filter->samples[slot];
+	int8_t p = filter->pos[slot];
+
+	if(p > 0){
+		if(full && old < value)
+			min_sort_down(filter, p * 2);
+		else if(min_sort_up(filter, p))
+			max_sort_down(filter, -1);
+	}else if(p < 0){
+		if(full && value < old)
+			max_sort_down(filter, p * 2);
+		else if(max_sort_up(filter, p))
+			min_sort_down(filter, 1);
+	}else{
+		if(MAX_COUNT(filter))
+			max_sort_down(filter, -1);
+		if(MIN_COUNT(filter))
+			min_sort_down(filter, 1);
+	}
+}
+
+void BH1750_filter_push(BH1750_filter_t* filter, uint32_t lux_q8)
+{
+	uint8_t slot = filter->head;
+	uint8_t full = filter->count == BH1750_FILTER_SIZE;
+	uint32_t old = filter->samples[slot];
+
+	//the oldest reading leaves the window, it can only be at the front
+	if(full){
+		if(filter->min_queue[filter->min_first] == slot){
+			filter->min_first = (filter->min_first + 1) & BH1750_FILTER_MASK;
+			filter->min_count--;
+		}
+		if(filter->max_queue[filter->max_first] == slot){
+			filter->max_first = (filter->max_first + 1) & BH1750_FILTER_MASK;
+			filter->max_count--;
+		}
+	}
+
+	filter->samples[slot] = lux_q8;
+	filter->head = (slot + 1) & BH1750_FILTER_MASK;
+	if(!full)
+		filter->count++;
+
+	if(filter->total++ == 0)
+		filter->ema = lux_q8;
+	else if(lux_q8 > filter->ema)
+		filter->ema += (lux_q8 - filter->ema) >> BH1750_FILTER_EMA_SHIFT;
+	else
+		filter->ema -= (filter->ema - lux_q8) >> BH1750_FILTER_EMA_SHIFT;
+
+	BH1750_filter_median_update(filter, slot, old, full);
+
+	//readings that can no longer be the min or max are dropped from the back
+	while(filter->min_count && filter->samples[filter->min_queue[
+			(filter->min_first + filter->min_count - 1) & BH1750_FILTER_MASK]] >= lux_q8)
+		filter->min_count--;
+	filter->min_queue[(filter->min_first + filter->min_count++) & BH1750_FILTER_MASK] = slot;
+
+	while(filter->max_count && filter->samples[filter->max_queue[
+			(filter->max_first + filter->max_count - 1) & BH1750_FILTER_MASK]] <= lux_q8)
+		filter->max_count--;
+	filter->max_queue[(filter->max_first + filter->max_count++) & BH1750_FILTER_MASK] = slot;
+}
+
+uint8_t BH1750_filter_read(BH1750_filter_t* filter, uint32_t* samples, uint8_t max)
+{
+	uint8_t first = (filter->head - filter->count) & BH1750_FILTER_MASK;
+	uint8_t i;
+
+	if(max > filter->count)
+		max = filter->count;
+
+	for(i = 0; i < max; i++)
+		samples[i] = filter->samples[(first + i) & BH1750_FILTER_MASK];
+
+	return max;
+}
+
+uint32_t BH1750_filter_last(BH1750_filter_t* filter)
+{
+	if(!filter->count)
+		return 0;
+
+	return filter->samples[(filter->head - 1) & BH1750_FILTER_MASK];
+}
+
+uint32_t BH1750_filter_ema(BH1750_filter_t* filter)
+{
+	return filter->ema;
+}
+
+uint32_t BH1750_filter_median(BH1750_filter_t* filter)
+{
+	if(!filter->count)
+		return 0;
+
+	return filter->samples[HEAP(filter)[0]];
+}
+
+uint32_t BH1750_filter_min(BH1750_filter_t* filter)
+{
+	if(!filter->min_count)
+		return 0;
+
+	return filter->samples[filter->min_queue[filter->min_first]];
+}
+
+uint32_t BH1750_filter_max(BH1750_filter_t* filter)
+{
+	if(!filter->max_count)
+		return 0;
+
+	return filter->samples[filter->max_queue[filter->max_first]];
+}
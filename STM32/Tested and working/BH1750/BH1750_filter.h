@@ -0,0 +1,107 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Streaming filters over the recent readings of a BH1750
+ *	
+ * Keeps the last BH1750_FILTER_SIZE readings of a device in a ring
+ * buffer inside the device struct and updates its filters as each reading
+ * comes in, so reading a filtered value never walks the history:
+ *
+ *	EMA             O(1), alpha 1 / 2^BH1750_FILTER_EMA_SHIFT
+ *	moving median   O(log n), a max heap below the median and a min heap
+ *	                above it over the same window as the ring
+ *	moving min/max  O(1) amortised, monotonic queues of ring slots
+ *
+ * BH1750_convert pushes every result, so both BH1750_get_lumen and the
+ * group scheduler feed the filters. Values are lux in Q24.8 as
+ * lux_q8, which holds the whole range of the sensor, so a bright
+ * reading is never clipped before it reaches the median or the max.
+ *
+ * Usage:
+ *	dev->poll(dev);
+ *	BH1750_filter_median(&dev->filter) >> 8
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef BH1750_FILTER_H_
+#define BH1750_FILTER_H_
+
+#include <stdint.h>
+
+//readings kept, a power of two up to 128
+#ifndef BH1750_FILTER_SIZE
+#define BH1750_FILTER_SIZE          16
+#endif
+//EMA weight of a new reading is 1 / 2^SHIFT
+#ifndef BH1750_FILTER_EMA_SHIFT
+#define BH1750_FILTER_EMA_SHIFT     3
+#endif
+
+#define BH1750_FILTER_MASK          (BH1750_FILTER_SIZE - 1)
+
+typedef struct BH1750_filter BH1750_filter_t;
+struct BH1750_filter{
+    uint32_t samples[BH1750_FILTER_SIZE];   //ring, lux in Q24.8
+    uint8_t head;           //slot of the next reading
+    uint8_t count;          //readings in the ring
+    uint32_t total;         //readings pushed since init
+
+    uint32_t ema;
+
+    //median heaps, heap[0] is the median, the max heap is at negative
+    //indices and the min heap at positive ones, heap entries are ring slots
+    int8_t pos[BH1750_FILTER_SIZE];     //heap index of each ring slot
+    uint8_t heap_buf[BH1750_FILTER_SIZE];
+
+    //ring slots in arrival order, values rising for min and falling for max
+    uint8_t min_queue[BH1750_FILTER_SIZE];
+    uint8_t min_first;
+    uint8_t min_count;
+    uint8_t max_queue[BH1750_FILTER_SIZE];
+    uint8_t max_first;
+    uint8_t max_count;
+};
+
+void BH1750_filter_init(BH1750_filter_t* filter);
+
+/**
+ * @brief Adds a reading, the oldest drops out once the ring is full
+ **/
+void BH1750_filter_push(BH1750_filter_t* filter, uint32_t lux_q8);
+
+/**
+ * @brief Copies the readings out, oldest first
+ *
+ * @return Number of readings copied
+ **/
+uint8_t BH1750_filter_read(BH1750_filter_t* filter, uint32_t* samples, uint8_t max);
+
+//all are 0 before the first reading
+uint32_t BH1750_filter_last(BH1750_filter_t* filter);
+uint32_t BH1750_filter_ema(BH1750_filter_t* filter);
+//upper median when the window holds an even number of readings
+uint32_t BH1750_filter_median(BH1750_filter_t* filter);
+uint32_t BH1750_filter_min(BH1750_filter_t* filter);
+uint32_t BH1750_filter_max(BH1750_filter_t* filter);
+
+#endif /* BH1750_FILTER_H_ */
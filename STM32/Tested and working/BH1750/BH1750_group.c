@@ -0,0 +1,142 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Interleaved conversions on groups of BH1750 devices
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include "BH1750_group.h"
+
+//one time modes power down after each result and need a new command
+#define BH1750_ONE_TIME(mode)   (((mode) & 0xF0) == 0x20)
+
+HAL_StatusTypeDef BH1750_group_add(BH1750_group_t* group, BH1750_device_t* dev)
+{
+	if(group->device_count >= BH1750_GROUP_MAX_DEVICES)
+		return HAL_ERROR;
+
+	group->devices[group->device_count++] = dev;
+
+	return HAL_OK;
+}
+
+static HAL_StatusTypeDef BH1750_group_start_dev(BH1750_group_t* group, uint8_t i)
+{
+	BH1750_device_t* dev = group->devices[i];
+
+	if(BH1750_send_command(dev, dev->mode) != HAL_OK){
+		group->running &= ~(1 << i);
+		group->errors++;
+		return HAL_ERROR;
+	}
+
+	group->deadlines[i] = HAL_GetTick() + BH1750_conversion_ms(dev);
+	group->running |= 1 << i;
+
+	return HAL_OK;
+}
+
+//continuous modes have the next result one conversion later, counted from
+//the read when the poll came late so that a result already read is not
+//read again as new
+static void BH1750_group_next_result(BH1750_group_t* group, uint8_t i)
+{
+	uint32_t conversion = BH1750_conversion_ms(group->devices[i]);
+	uint32_t now = HAL_GetTick();
+
+	group->deadlines[i] += conversion;
+	if((int32_t)(group->deadlines[i] - (now + conversion)) < 0)
+		group->deadlines[i] = now + conversion;
+}
+
+HAL_StatusTypeDef BH1750_group_start(BH1750_group_t* group)
+{
+	HAL_StatusTypeDef ret = HAL_OK;
+	uint8_t i;
+
+	//commands back to back so that the conversions overlap
+	for(i = 0; i < group->device_count; i++)
+		if(BH1750_group_start_dev(group, i) != HAL_OK)
+			ret = HAL_ERROR;
+
+	return ret;
+}
+
+uint8_t BH1750_group_poll(BH1750_group_t* group)
+{
+	BH1750_device_t* dev;
+	uint8_t updated = 0;
+	uint8_t i;
+
+	for(i = 0; i < group->device_count; i++){
+		dev = group->devices[i];
+
+		if(!(group->running & (1 << i))){
+			BH1750_group_start_dev(group, i);
+			continue;
+		}
+
+		//wrap safe, HAL_GetTick overflows after 49 days
+		if((int32_t)(HAL_GetTick() - group->deadlines[i]) < 0)
+			continue;
+
+		if(BH1750_read_dev(dev) != HAL_OK){
+			group->errors++;
+			continue;
+		}
+
+		BH1750_convert(dev);
+		updated |= 1 << i;
+		group->samples++;
+
+		if(dev->autorange && BH1750_autorange(dev))
+			//restarted at the new settings
+			group->deadlines[i] = HAL_GetTick() + BH1750_conversion_ms(dev);
+		else if(BH1750_ONE_TIME(dev->mode))
+			BH1750_group_start_dev(group, i);
+		else
+			BH1750_group_next_result(group, i);
+	}
+
+	return updated;
+}
+
+uint32_t BH1750_group_next_ms(BH1750_group_t* group)
+{
+	uint32_t now = HAL_GetTick();
+	uint32_t next = UINT32_MAX;
+	int32_t left;
+	uint8_t i;
+
+	for(i = 0; i < group->device_count; i++){
+		if(!(group->running & (1 << i)))
+			return 0;
+		left = (int32_t)(group->deadlines[i] - now);
+		if(left <= 0)
+			return 0;
+		if((uint32_t)left < next)
+			next = left;
+	}
+
+	return (next == UINT32_MAX) ? 0 : next;
+}
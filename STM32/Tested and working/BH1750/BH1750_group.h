@@ -0,0 +1,99 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Interleaved conversions on groups of BH1750 devices
+ *	
+ * Keeps several BH1750s converting at once. BH1750_group_start sends every
+ * device its measurement command back to back and notes when each result
+ * will be ready. BH1750_group_poll never waits: it reads every device
+ * whose deadline has passed in one sweep, restarts one time modes
+ * straight away and leaves the others until their next result. A poll
+ * that comes late reads the newest result and then waits a whole
+ * conversion, so no result is counted twice. With N sensors, on any
+ * mix of addresses and buses, N samples arrive per conversion time rather
+ * than one.
+ *
+ * Usage:
+ *	BH1750_group_t group = {0};
+ *	BH1750_group_add(&group, left);
+ *	BH1750_group_add(&group, right);
+ *	BH1750_group_start(&group);
+ *
+ *	//main loop
+ *	if(BH1750_group_poll(&group) & (1 << 0))
+ *		...left->value is new...
+ *	sleep for BH1750_group_next_ms(&group)
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef BH1750_GROUP_H_
+#define BH1750_GROUP_H_
+
+#include "stm32f4xx_hal.h"
+
+#include "BH1750.h"
+
+#define BH1750_GROUP_MAX_DEVICES    8
+
+typedef struct BH1750_group BH1750_group_t;
+struct BH1750_group{
+    BH1750_device_t* devices[BH1750_GROUP_MAX_DEVICES];
+    uint8_t device_count;
+
+    uint32_t deadlines[BH1750_GROUP_MAX_DEVICES];   //tick the next result is ready
+    uint8_t running;        //devices converting, bit per device
+
+    uint32_t samples;       //results collected
+    uint32_t errors;        //failed transfers, retried on the next poll
+};
+
+/**
+ * @brief Adds an initialised device, its mode field picks the measurement
+ *
+ * @return HAL_ERROR if the group is full
+ **/
+HAL_StatusTypeDef BH1750_group_add(BH1750_group_t* group, BH1750_device_t* dev);
+
+/**
+ * @brief Starts a conversion on every device
+ *
+ * @return HAL_ERROR if any device did not take its command, it is
+ * started again on the next poll
+ **/
+HAL_StatusTypeDef BH1750_group_start(BH1750_group_t* group);
+
+/**
+ * @brief Reads every device whose result is ready, never waits for one
+ *
+ * @return Devices with a new value, bit per device in the order added
+ **/
+uint8_t BH1750_group_poll(BH1750_group_t* group);
+
+/**
+ * @brief Time until the next result is ready
+ *
+ * @return ms, 0 if a result is ready now
+ **/
+uint32_t BH1750_group_next_ms(BH1750_group_t* group);
+
+#endif /* BH1750_GROUP_H_ */
@@ -0,0 +1,165 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Host check of the BH1750 lux conversion and auto-ranging
+ *	
+ * Converts every count at every MTreg in H, H2 and L mode and compares
+ * lux_q8 and value with the exact lux, checks that value is lux_q8
+ * rounded and that the filter gets lux_q8. Then steps a sensor model
+ * through light levels from 0.05 to 100000 lx with auto-ranging on and
+ * prints the mode, MTreg, conversion time and reading it settles at.
+ * Returns non zero if a conversion is off by more than the rounding of
+ * the format or a settled reading is off by more than a count.
+ *
+ * Build and run from the BH1750 directory:
+ *	gcc -O2 -Wall -Ihost -I. host/bh1750_convert_test.c BH1750.c \
+ *		BH1750_filter.c host/bh1750_host.c -lm -o convert_test
+ *	./convert_test
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <math.h>
+#include <stdio.h>
+
+#include "stm32f4xx_hal.h"
+
+#include "BH1750.h"
+#include "bh1750_host.h"
+
+//half a Q24.8 step plus the rounding of lux_scale over 65535 counts
+#define MAX_Q8_ERROR	(1.0 / 512 + 65535.0 / (1 << 25))
+
+static const uint8_t modes[] = {
+	CMD_H_RES_MODE, CMD_H_RES_MODE2, CMD_L_RES_MODE
+};
+
+static double exact_lux(uint32_t raw, uint8_t mtreg, uint8_t mode)
+{
+	return raw / 1.2 * BH1750_MTREG_DEFAULT / mtreg /
+			((mode == CMD_H_RES_MODE2) ? 2 : 1);
+}
+
+//lux of one count, L mode counts in steps of 4
+static double step_lux(BH1750_device_t* dev)
+{
+	return exact_lux((dev->mode & 0x0F) == 0x03 ? 4 : 1, dev->mtreg,
+			dev->mode & 0x1F);
+}
+
+static uint8_t check_conversion(BH1750_device_t* dev)
+{
+	double exact, error, max_q8 = 0, max_value = 0;
+	uint32_t top = 0, mismatches = 0, raw;
+	uint16_t mtreg;
+	uint8_t m;
+
+	for(mtreg = BH1750_MTREG_MIN; mtreg <= BH1750_MTREG_MAX; mtreg++){
+		BH1750_set_mtreg(dev, mtreg);
+		for(m = 0; m < sizeof(modes); m++){
+			dev->mode = modes[m];
+			for(raw = 0; raw <= 0xFFFF; raw++){
+				dev->buffer[0] = raw >> 8;
+				dev->buffer[1] = raw & 0xFF;
+				BH1750_convert(dev);
+
+				exact = exact_lux(raw, mtreg, modes[m]);
+				error = fabs(dev->lux_q8 / 256.0 - exact);
+				if(error > max_q8)
+					max_q8 = error;
+				error = fabs(dev->value - exact);
+				if(error > max_value)
+					max_value = error;
+				if(dev->value > top)
+					top = dev->value;
+
+				if(dev->value != (dev->lux_q8 + 0x80) >> 8 ||
+						BH1750_filter_last(&dev->filter) != dev->lux_q8)
+					mismatches++;
+			}
+		}
+	}
+
+	printf("max |lux_q8 - exact| %.5f lx, max |value - exact| %.5f lx, "
+			"top %u lx, %u mismatches\n", max_q8, max_value, top, mismatches);
+
+	return max_q8 > MAX_Q8_ERROR || max_value > 0.5 + MAX_Q8_ERROR ||
+			mismatches || top != 121557;
+}
+
+static uint8_t check_autorange(BH1750_device_t* dev, bh1750_host_t* chip)
+{
+	static const double levels[] = {
+		0.05, 0.5, 5, 50, 500, 1500, 5000, 20000, 60000, 100000, 300, 2
+	};
+	uint8_t failed = 0, changes, bad;
+	double error;
+	uint8_t i;
+
+	BH1750_set_mtreg(dev, BH1750_MTREG_DEFAULT);
+	BH1750_set_mode(dev, CMD_H_RES_MODE);
+
+	for(i = 0; i < sizeof(levels) / sizeof(levels[0]); i++){
+		chip->lux = levels[i];
+
+		//a new level is read once at the old settings, then restarts
+		//until the settings hold
+		for(changes = 0; changes < 10; changes++){
+			HAL_Delay(BH1750_conversion_ms(dev));
+			BH1750_read_dev(dev);
+			BH1750_convert(dev);
+			if(!BH1750_autorange(dev))
+				break;
+		}
+
+		error = fabs(dev->lux_q8 / 256.0 - levels[i]);
+		bad = (error > step_lux(dev) + MAX_Q8_ERROR) || (changes == 10);
+		failed |= bad;
+
+		printf("%9.2f lx: mode %02X MTreg %3u %3u ms, step %6.3f lx, "
+				"read %10.3f lx (%u changes)%s\n", levels[i], dev->mode,
+				dev->mtreg, BH1750_conversion_ms(dev), step_lux(dev),
+				dev->lux_q8 / 256.0, changes, bad ? " FAILED" : "");
+	}
+
+	return failed;
+}
+
+int main(void)
+{
+	I2C_HandleTypeDef bus;
+	bh1750_host_t chip = {0};
+	BH1750_device_t* dev = BH1750_init_dev_struct(&bus, "test", true);
+	uint8_t failed;
+
+	if(dev == NULL)
+		return 1;
+
+	bh1750_host_spread = 0;
+	bh1750_host_init(&chip, &bus, dev->address_w);
+
+	failed = check_conversion(dev);
+	failed |= check_autorange(dev, &chip);
+
+	printf(failed ? "FAILED\n" : "passed\n");
+	return failed;
+}
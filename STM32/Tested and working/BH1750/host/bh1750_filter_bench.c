@@ -0,0 +1,203 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Host check and benchmark of the BH1750 streaming filters
+ *	
+ * Pushes 200000 random readings over the whole Q24.8 range, many of them
+ * repeated, and after every push compares the median, min and max with a
+ * sorted copy of the window. Converts the brightest count at the
+ * shortest MTreg through BH1750_convert and checks that it reaches the
+ * filter unclipped. Then times the streaming filters against a ring
+ * that is sorted and scanned on every reading. Returns non zero on any
+ * mismatch.
+ *
+ * Build and run from the BH1750 directory, -DBH1750_FILTER_SIZE=n checks
+ * other window sizes:
+ *	gcc -O2 -Wall -Ihost -I. host/bh1750_filter_bench.c BH1750.c \
+ *		BH1750_filter.c host/bh1750_host.c -lm -o filter_bench
+ *	./filter_bench
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "stm32f4xx_hal.h"
+
+#include "BH1750.h"
+
+#define CHECK_PUSHES	200000
+#define BENCH_PUSHES	2000000
+//65535 counts at MTreg 31
+#define TOP_LUX_Q8		(121557UL << 8)
+
+static int compare(const void* a, const void* b)
+{
+	uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+
+	return (x > y) - (x < y);
+}
+
+static uint32_t random_reading(uint32_t n)
+{
+	//mostly a few nearby values so that ties are common, with spikes
+	//anywhere in the range
+	if(n % 7 == 0)
+		return ((uint32_t)rand() << 8 ^ rand()) % (TOP_LUX_Q8 + 1);
+
+	return (500 + rand() % 50) << 8;
+}
+
+static uint8_t check_window(void)
+{
+	static BH1750_filter_t filter;
+	uint32_t window[BH1750_FILTER_SIZE], sorted[BH1750_FILTER_SIZE];
+	uint32_t n, value, mismatches = 0;
+	uint8_t count = 0, head = 0;
+
+	BH1750_filter_init(&filter);
+	srand(3);
+
+	for(n = 0; n < CHECK_PUSHES; n++){
+		value = random_reading(n);
+		BH1750_filter_push(&filter, value);
+
+		window[head] = value;
+		head = (head + 1) & BH1750_FILTER_MASK;
+		if(count < BH1750_FILTER_SIZE)
+			count++;
+
+		memcpy(sorted, window, sizeof(sorted));
+		qsort(sorted, count, sizeof(sorted[0]), compare);
+
+		if(BH1750_filter_min(&filter) != sorted[0] ||
+				BH1750_filter_max(&filter) != sorted[count - 1] ||
+				BH1750_filter_median(&filter) != sorted[count / 2])
+			mismatches++;
+	}
+
+	printf("size %u: %u pushes, %u mismatches against a sorted window\n",
+			BH1750_FILTER_SIZE, CHECK_PUSHES, mismatches);
+
+	return mismatches != 0;
+}
+
+static uint8_t check_top(void)
+{
+	I2C_HandleTypeDef bus;
+	BH1750_device_t* dev = BH1750_init_dev_struct(&bus, "top", true);
+	uint32_t max;
+
+	if(dev == NULL)
+		return 1;
+
+	dev->mtreg = BH1750_MTREG_MIN;
+	dev->lux_scale = ((BH1750_LUX_Q16_FACTOR << 8) + BH1750_MTREG_MIN / 2) /
+			BH1750_MTREG_MIN;
+	dev->buffer[0] = 0xFF;
+	dev->buffer[1] = 0xFF;
+	BH1750_convert(dev);
+
+	max = BH1750_filter_max(&dev->filter);
+	printf("65535 counts at MTreg %u: value %u lx, filter max %.3f lx\n",
+			BH1750_MTREG_MIN, dev->value, max / 256.0);
+
+	return max != dev->lux_q8 || (max + 0x80) >> 8 != dev->value;
+}
+
+static double elapsed_ns(struct timespec* start, struct timespec* end)
+{
+	return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+static void bench(void)
+{
+	static BH1750_filter_t filter;
+	static uint32_t input[1 << 16];
+	uint32_t ring[BH1750_FILTER_SIZE] = {0}, sorted[BH1750_FILTER_SIZE];
+	uint32_t i, value, ema = 0, min, max;
+	volatile uint32_t sink = 0;
+	struct timespec start, end;
+	uint8_t count = 0, head = 0, j, k;
+
+	for(i = 0; i < (1 << 16); i++)
+		input[i] = random_reading(i);
+
+	BH1750_filter_init(&filter);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(i = 0; i < BENCH_PUSHES; i++){
+		BH1750_filter_push(&filter, input[i & 0xFFFF]);
+		sink += BH1750_filter_median(&filter) + BH1750_filter_min(&filter) +
+				BH1750_filter_max(&filter) + BH1750_filter_ema(&filter);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	printf("size %u: streaming %.1f ns/reading", BH1750_FILTER_SIZE,
+			elapsed_ns(&start, &end) / BENCH_PUSHES);
+
+	//what the filters replace, an insertion sort and a scan per reading
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(i = 0; i < BENCH_PUSHES; i++){
+		value = input[i & 0xFFFF];
+		ring[head] = value;
+		head = (head + 1) & BH1750_FILTER_MASK;
+		if(count < BH1750_FILTER_SIZE)
+			count++;
+		if(i == 0)
+			ema = value;
+		else if(value > ema)
+			ema += (value - ema) >> BH1750_FILTER_EMA_SHIFT;
+		else
+			ema -= (ema - value) >> BH1750_FILTER_EMA_SHIFT;
+
+		min = UINT32_MAX;
+		max = 0;
+		for(j = 0; j < count; j++){
+			value = ring[j];
+			for(k = j; k > 0 && sorted[k - 1] > value; k--)
+				sorted[k] = sorted[k - 1];
+			sorted[k] = value;
+			if(value < min)
+				min = value;
+			if(value > max)
+				max = value;
+		}
+		sink += sorted[count / 2] + min + max + ema;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	printf(", sort and scan %.1f ns/reading\n",
+			elapsed_ns(&start, &end) / BENCH_PUSHES);
+}
+
+int main(void)
+{
+	uint8_t failed;
+
+	failed = check_window();
+	failed |= check_top();
+	bench();
+
+	printf(failed ? "FAILED\n" : "passed\n");
+	return failed;
+}
@@ -0,0 +1,149 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Host simulation of BH1750 group throughput
+ *	
+ * Four sensors on two buses, both addresses on each, measured for 10 s
+ * of simulated time: one after the other with a full wait per one time
+ * conversion, then as a group in one time and continuous H mode with the
+ * poller sleeping BH1750_group_next_ms between polls, and in continuous
+ * mode with a poller that stalls for a second every 25 polls. Prints the
+ * samples per second of each and the fresh and stale reads the sensor
+ * models saw. Returns non zero if the group counted a stale read as a
+ * sample.
+ *
+ * Build and run from the BH1750 directory:
+ *	gcc -O2 -Wall -Ihost -I. host/bh1750_group_sim.c BH1750.c \
+ *		BH1750_filter.c BH1750_group.c host/bh1750_host.c -lm -o group_sim
+ *	./group_sim
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "stm32f4xx_hal.h"
+
+#include "BH1750.h"
+#include "BH1750_group.h"
+#include "bh1750_host.h"
+
+#define SENSORS		4
+#define SIM_US		10000000ULL
+#define STALL_EVERY	25
+#define STALL_MS	1000
+#define LATE_POLL_MS	20
+
+static I2C_HandleTypeDef buses[2];
+static bh1750_host_t chips[SENSORS];
+static BH1750_device_t* devs[SENSORS];
+
+static void setup(uint8_t mode)
+{
+	static char* names[SENSORS] = {"a", "b", "c", "d"};
+	uint8_t i;
+
+	bh1750_host_reset();
+	srand(1);
+	for(i = 0; i < SENSORS; i++){
+		if(devs[i] == NULL)
+			devs[i] = BH1750_init_dev_struct(&buses[i / 2], names[i], i & 1);
+		devs[i]->mode = mode;
+		chips[i].lux = 100 + 50 * i;
+		bh1750_host_init(&chips[i], &buses[i / 2], devs[i]->address_w);
+	}
+}
+
+static void reads(uint32_t* fresh, uint32_t* stale)
+{
+	uint8_t i;
+
+	*fresh = *stale = 0;
+	for(i = 0; i < SENSORS; i++){
+		*fresh += chips[i].fresh_reads;
+		*stale += chips[i].stale_reads;
+	}
+}
+
+static uint8_t run_group(const char* name, uint8_t mode, uint8_t late)
+{
+	BH1750_group_t group = {0};
+	uint32_t polls = 0, fresh, stale, wait;
+	uint8_t i;
+
+	setup(mode);
+	for(i = 0; i < SENSORS; i++)
+		BH1750_group_add(&group, devs[i]);
+
+	BH1750_group_start(&group);
+	while(bh1750_host_now_us() < SIM_US){
+		BH1750_group_poll(&group);
+		polls++;
+
+		if(late){
+			wait = (polls % STALL_EVERY) ? LATE_POLL_MS : STALL_MS;
+			bh1750_host_advance_us(wait * 1000ULL);
+		}else{
+			wait = BH1750_group_next_ms(&group);
+			bh1750_host_advance_us(wait ? wait * 1000ULL : 100);
+		}
+	}
+
+	reads(&fresh, &stale);
+	printf("%-30s %6.2f samples/s, fresh %4u stale %4u errors %u%s\n", name,
+			group.samples / (bh1750_host_now_us() / 1e6), fresh, stale,
+			group.errors, (group.samples != fresh) ? " FAILED" : "");
+
+	return group.samples != fresh;
+}
+
+int main(void)
+{
+	uint32_t samples = 0, fresh, stale;
+	uint8_t failed = 0, i;
+
+	setup(CMD_ONE_H_RES_MODE);
+	while(bh1750_host_now_us() < SIM_US){
+		for(i = 0; i < SENSORS; i++){
+			BH1750_send_command(devs[i], devs[i]->mode);
+			HAL_Delay(BH1750_conversion_ms(devs[i]));
+			BH1750_get_lumen(devs[i]);
+			samples++;
+		}
+	}
+	reads(&fresh, &stale);
+	printf("%-30s %6.2f samples/s, fresh %4u stale %4u\n",
+			"sequential one time", samples / (bh1750_host_now_us() / 1e6),
+			fresh, stale);
+
+	failed |= run_group("group one time", CMD_ONE_H_RES_MODE, 0);
+	failed |= run_group("group continuous", CMD_H_RES_MODE, 0);
+	failed |= run_group("group continuous, late poller", CMD_H_RES_MODE, 1);
+
+	printf("%-30s %6.2f samples/s at the maximum, %.2f typical\n",
+			"4 sensors converting at once", SENSORS * 1000.0 /
+			BH1750_H_RES_MAX_MS, SENSORS * 1000.0 / 120);
+
+	printf(failed ? "FAILED\n" : "passed\n");
+	return failed;
+}
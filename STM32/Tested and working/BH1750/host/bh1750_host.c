@@ -0,0 +1,205 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Model of the BH1750 ambient light sensor for host builds
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "bh1750_host.h"
+
+//datasheet p2, at the default MTreg of 69
+#define HOST_H_TYP_US		120000
+#define HOST_H_MAX_US		180000
+#define HOST_L_TYP_US		16000
+#define HOST_L_MAX_US		24000
+#define HOST_MTREG_DEFAULT	69
+//one byte and its acknowledge at 100 kHz
+#define HOST_BYTE_US		90
+
+uint8_t bh1750_host_spread = 1;
+
+static uint64_t host_us = 0;
+static bh1750_host_t* host_chips = NULL;
+
+void HAL_Delay(uint32_t Delay)
+{
+	host_us += (uint64_t)Delay * 1000;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return (uint32_t)(host_us / 1000);
+}
+
+uint64_t bh1750_host_now_us(void)
+{
+	return host_us;
+}
+
+void bh1750_host_advance_us(uint64_t us)
+{
+	host_us += us;
+}
+
+void bh1750_host_reset(void)
+{
+	host_chips = NULL;
+	host_us = 0;
+}
+
+void bh1750_host_init(bh1750_host_t* chip, I2C_HandleTypeDef* bus,
+		uint8_t address_w)
+{
+	double lux = chip->lux;
+	bh1750_host_t** link;
+
+	*chip = (bh1750_host_t){0};
+	chip->bus = bus;
+	chip->address = address_w & 0xFE;
+	chip->lux = lux;
+	chip->mtreg = HOST_MTREG_DEFAULT;
+
+	for(link = &host_chips; *link != NULL; link = &(*link)->next)
+		if(*link == chip)
+			break;
+	if(*link == NULL)
+		*link = chip;
+}
+
+static bh1750_host_t* host_find(I2C_HandleTypeDef* bus, uint16_t address)
+{
+	bh1750_host_t* chip;
+
+	for(chip = host_chips; chip != NULL; chip = chip->next)
+		if(chip->bus == bus && chip->address == (address & 0xFE))
+			return chip;
+
+	return NULL;
+}
+
+static uint64_t host_conversion_us(bh1750_host_t* chip)
+{
+	uint8_t low = (chip->mode & 0x0F) == 0x03;
+	uint64_t typ = low ? HOST_L_TYP_US : HOST_H_TYP_US;
+	uint64_t max = low ? HOST_L_MAX_US : HOST_H_MAX_US;
+	uint64_t us = bh1750_host_spread ? typ + rand() % (max - typ + 1) : max;
+
+	return us * chip->mtreg / HOST_MTREG_DEFAULT;
+}
+
+static uint16_t host_count(bh1750_host_t* chip)
+{
+	double count = chip->lux * 1.2 * chip->mtreg / HOST_MTREG_DEFAULT;
+
+	if((chip->mode & 0x0F) == 0x01)
+		count *= 2;
+	if((chip->mode & 0x0F) == 0x03)
+		count = floor(count / 4) * 4;
+
+	return (count > 65535) ? 65535 : (uint16_t)count;
+}
+
+//finishes the conversions that are due by now
+static void host_update(bh1750_host_t* chip)
+{
+	while(chip->converting && host_us >= chip->ready_us){
+		chip->result = host_count(chip);
+		chip->results++;
+
+		if(chip->mode & 0x20)
+			chip->converting = 0;
+		else
+			chip->ready_us += host_conversion_us(chip);
+	}
+}
+
+static void host_command(bh1750_host_t* chip, uint8_t cmd)
+{
+	chip->commands++;
+
+	if(cmd == 0x00){
+		chip->converting = 0;
+	}else if(cmd == 0x03){
+		chip->result = 0;
+	}else if((cmd & 0xF8) == 0x40){
+		chip->mtreg_high = cmd & 0x07;
+	}else if((cmd & 0xE0) == 0x60){
+		chip->mtreg = (chip->mtreg_high << 5) | (cmd & 0x1F);
+	}else if(cmd >= 0x10 && cmd <= 0x23){
+		//a new command restarts the measurement
+		chip->mode = cmd;
+		chip->converting = 1;
+		chip->ready_us = host_us + host_conversion_us(chip);
+	}
+}
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c)
+{
+	(void)hi2c;
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c,
+		uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	bh1750_host_t* chip = host_find(hi2c, DevAddress);
+	uint16_t i;
+
+	(void)Timeout;
+	host_us += (Size + 1) * HOST_BYTE_US;
+	if(chip == NULL)
+		return HAL_ERROR;
+
+	host_update(chip);
+	for(i = 0; i < Size; i++)
+		host_command(chip, pData[i]);
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Receive(I2C_HandleTypeDef *hi2c,
+		uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	bh1750_host_t* chip = host_find(hi2c, DevAddress);
+
+	(void)Timeout;
+	host_us += (Size + 1) * HOST_BYTE_US;
+	if(chip == NULL || Size < 2)
+		return HAL_ERROR;
+
+	host_update(chip);
+	if(chip->results != chip->results_read)
+		chip->fresh_reads++;
+	else
+		chip->stale_reads++;
+	chip->results_read = chip->results;
+
+	pData[0] = chip->result >> 8;
+	pData[1] = chip->result & 0xFF;
+
+	return HAL_OK;
+}
@@ -0,0 +1,91 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Model of the BH1750 ambient light sensor for host builds
+ *	
+ * Each model sits at one address on one I2C handle and measures the
+ * illuminance in its lux field. Measurement commands start conversions
+ * that take between the datasheet's typical and maximum time, scaled by
+ * MTreg; continuous modes keep converting and one time modes power down
+ * after a result. Counts follow lux * 1.2 * MTreg / 69, doubled in H
+ * mode 2, in steps of 4 in L mode and clipped at 65535.
+ *
+ * Time is kept in microseconds and drives HAL_GetTick. Every transfer
+ * takes its bytes at 100 kHz, and every read is counted as fresh when it
+ * returns a result not read before, stale otherwise.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef BH1750_HOST_H_
+#define BH1750_HOST_H_
+
+#include <stdint.h>
+
+#include "stm32f4xx_hal.h"
+
+typedef struct bh1750_host bh1750_host_t;
+struct bh1750_host{
+	I2C_HandleTypeDef* bus;
+	uint8_t address;			/*!< 8 bit write address */
+	double lux;					/*!< Light falling on the sensor */
+
+	uint8_t mode;				/*!< Last measurement command */
+	uint8_t mtreg;
+	uint8_t mtreg_high;			/*!< Upper MTreg bits waiting for the low command */
+	uint8_t converting;
+	uint64_t ready_us;			/*!< End of the running conversion */
+
+	uint16_t result;
+	uint32_t results;			/*!< Conversions finished */
+	uint32_t results_read;		/*!< results at the last read */
+
+	uint32_t fresh_reads;
+	uint32_t stale_reads;
+	uint32_t commands;
+
+	bh1750_host_t* next;
+};
+
+/**
+ * @brief Powers the model up at the default MTreg and attaches it
+ *
+ * @param address_w - 8 bit write address the driver uses
+ **/
+void bh1750_host_init(bh1750_host_t* chip, I2C_HandleTypeDef* bus,
+		uint8_t address_w);
+
+/**
+ * @brief Detaches every model and sets the time back to 0
+ **/
+void bh1750_host_reset(void);
+
+uint64_t bh1750_host_now_us(void);
+void bh1750_host_advance_us(uint64_t us);
+
+/**
+ * @brief Conversion spread, 0 for always the maximum time, 1 for uniform
+ * between typical and maximum, the default
+ **/
+extern uint8_t bh1750_host_spread;
+
+#endif /* BH1750_HOST_H_ */
@@ -0,0 +1,81 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Minimal STM32 HAL replacement for building the BH1750 library
+ *          on a host machine
+ *	
+ * Put this directory in front of the real HAL on the include path. The
+ * blocking I2C transfers made by the driver then go to the sensor models
+ * in bh1750_host.c, which also keep the time HAL_GetTick returns.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef BH1750_HOST_HAL_H_
+#define BH1750_HOST_HAL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum
+{
+	HAL_OK       = 0x00U,
+	HAL_ERROR    = 0x01U,
+	HAL_BUSY     = 0x02U,
+	HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef struct {
+	uint32_t ClockSpeed;
+	uint32_t DutyCycle;
+	uint32_t OwnAddress1;
+	uint32_t AddressingMode;
+	uint32_t DualAddressMode;
+	uint32_t OwnAddress2;
+	uint32_t GeneralCallMode;
+	uint32_t NoStretchMode;
+} I2C_InitTypeDef;
+
+typedef struct {
+	uint32_t Instance;
+	I2C_InitTypeDef Init;
+} I2C_HandleTypeDef;
+
+#define I2C1						1
+#define I2C_DUTYCYCLE_2				0
+#define I2C_ADDRESSINGMODE_7BIT		0
+#define I2C_DUALADDRESS_DISABLE		0
+#define I2C_GENERALCALL_DISABLE		0
+#define I2C_NOSTRETCH_DISABLE		0
+
+#define __HAL_RCC_GPIOB_CLK_ENABLE()	do{}while(0)
+
+void HAL_Delay(uint32_t Delay);
+uint32_t HAL_GetTick(void);
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c,
+		uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Master_Receive(I2C_HandleTypeDef *hi2c,
+		uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+
+#endif /* BH1750_HOST_HAL_H_ */
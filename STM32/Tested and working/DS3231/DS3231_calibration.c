@@ -0,0 +1,172 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   DS3231 drift calibration through the aging offset register
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+
+#include "DS3231_calibration.h"
+
+void DS3231_calibration_reset(ds3231Calibration* cal)
+{
+	cal->count = 0;
+	cal->mean_x = 0;
+	cal->mean_y = 0;
+	cal->m2_x = 0;
+	cal->c_xy = 0;
+}
+
+HAL_StatusTypeDef DS3231_calibration_init(ds3231Calibration* cal,
+		I2C_HandleTypeDef *hi2c, uint32_t min_window_s,
+		ds3231CalibrationLog log, void* log_context)
+{
+	u08 aging;
+
+	cal->port = hi2c;
+	cal->min_window_s = min_window_s;
+	cal->log = log;
+	cal->log_context = log_context;
+	cal->steps = 0;
+
+	DS3231_calibration_reset(cal);
+
+	if(HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, DS3231_AGING, 1, &aging, 1, 10)
+			!= HAL_OK)
+		return HAL_ERROR;
+
+	cal->offset = (int8_t)aging;
+
+	return HAL_OK;
+}
+
+int32_t DS3231_calibration_error_ppb(ds3231Calibration* cal)
+{
+	if(cal->count < 2 || cal->m2_x <= 0)
+		return 0;
+
+	//slope in microseconds per second is ppm
+	return (int32_t)(cal->c_xy / cal->m2_x * 1000.0f);
+}
+
+static HAL_StatusTypeDef DS3231_calibration_write(ds3231Calibration* cal,
+		int8_t offset)
+{
+	u08 aging = (u08)offset;
+	u08 control_register;
+
+	if(HAL_I2C_Mem_Write(cal->port, DS3231_ADDR8, DS3231_AGING, 1, &aging, 1,
+			10) != HAL_OK)
+		return HAL_ERROR;
+
+	//the offset is applied at the next temperature conversion, force one
+	if(HAL_I2C_Mem_Read(cal->port, DS3231_ADDR8, DS3231_CONTROL, 1,
+			&control_register, 1, 10) != HAL_OK)
+		return HAL_ERROR;
+
+	control_register |= (1 << CONV);
+
+	return HAL_I2C_Mem_Write(cal->port, DS3231_ADDR8, DS3231_CONTROL, 1,
+			&control_register, 1, 10);
+}
+
+static HAL_StatusTypeDef DS3231_calibration_correct(ds3231Calibration* cal,
+		uint32_t window_s, int32_t drift_us)
+{
+	ds3231CalibrationStep step;
+	int32_t error_ppb = DS3231_calibration_error_ppb(cal);
+	int32_t offset;
+
+	step.step = cal->steps + 1;
+	step.samples = cal->count;
+	step.window_s = window_s;
+	step.error_ppb = error_ppb;
+	step.drift_us = drift_us;
+	step.old_offset = cal->offset;
+	step.status = HAL_OK;
+
+	DS3231_calibration_reset(cal);
+
+	if(error_ppb > -DS3231_CALIBRATION_DEADBAND_PPB &&
+			error_ppb < DS3231_CALIBRATION_DEADBAND_PPB){
+		step.new_offset = cal->offset;
+	}else{
+		//round to the nearest LSB, a fast RTC needs a larger offset
+		offset = cal->offset + (error_ppb + (error_ppb >= 0 ?
+				DS3231_AGING_PPB_PER_LSB / 2 : -DS3231_AGING_PPB_PER_LSB / 2)) /
+				DS3231_AGING_PPB_PER_LSB;
+		if(offset > 127)
+			offset = 127;
+		if(offset < -128)
+			offset = -128;
+
+		step.new_offset = (int8_t)offset;
+		if(step.new_offset != cal->offset){
+			step.status = DS3231_calibration_write(cal, step.new_offset);
+			if(step.status == HAL_OK)
+				cal->offset = step.new_offset;
+		}
+	}
+
+	cal->steps++;
+
+	if(cal->log != NULL)
+		cal->log(cal->log_context, &step);
+
+	return step.status;
+}
+
+HAL_StatusTypeDef DS3231_calibration_sample(ds3231Calibration* cal,
+		uint64_t reference_us, uint32_t rtc_seconds)
+{
+	float x, y, dx;
+	int32_t residual;
+
+	if(!cal->count){
+		cal->first_rtc = rtc_seconds;
+		cal->first_reference = reference_us;
+	}
+
+	//microseconds the RTC has gained on the reference since the first sample
+	x = (float)(rtc_seconds - cal->first_rtc);
+	residual = (int32_t)((int64_t)(rtc_seconds - cal->first_rtc) * 1000000 -
+			(int64_t)(reference_us - cal->first_reference));
+	y = (float)residual;
+
+	//running update of the means and co-moments. Only centred terms are
+	//summed, so single precision, which the FPU handles, holds up over
+	//windows of days where plain sums of x*x would not
+	cal->count++;
+	dx = x - cal->mean_x;
+	cal->mean_x += dx / cal->count;
+	cal->mean_y += (y - cal->mean_y) / cal->count;
+	cal->m2_x += dx * (x - cal->mean_x);
+	cal->c_xy += dx * (y - cal->mean_y);
+
+	if(cal->count >= DS3231_CALIBRATION_MIN_SAMPLES &&
+			rtc_seconds - cal->first_rtc >= cal->min_window_s)
+		return DS3231_calibration_correct(cal, rtc_seconds - cal->first_rtc,
+				residual);
+
+	return HAL_OK;
+}
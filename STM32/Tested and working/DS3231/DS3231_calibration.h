@@ -0,0 +1,118 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   DS3231 drift calibration through the aging offset register
+ *	
+ * Each sample pairs the start of an RTC second (the falling SQW edge) with
+ * the time of a reference clock (GPS PPS, NTP, a calibrated timer...) at
+ * that instant. The difference between the two, in microseconds, is
+ * fitted against the RTC seconds with a least-squares line whose slope is
+ * the RTC's frequency error in ppm. Once a window of at least
+ * min_window_s seconds is collected the error is corrected through the
+ * aging offset register, one LSB of which is about 0.1 ppm at 25 C
+ * (positive values slow the oscillator), a conversion is forced so the new
+ * offset takes effect straight away and a new window starts.
+ *
+ * Every correction is passed to the log callback.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef DS3231_CALIBRATION_H_
+#define DS3231_CALIBRATION_H_
+
+#include "DS3231_stm32_hal.h"
+
+/** Frequency change of one aging offset LSB in parts per billion */
+#define DS3231_AGING_PPB_PER_LSB	100
+
+/** Errors smaller than this are not corrected */
+#define DS3231_CALIBRATION_DEADBAND_PPB	50
+
+#define DS3231_CALIBRATION_MIN_SAMPLES	8
+
+typedef struct {
+	uint32_t step;			/*!< Number of the correction, from 1 */
+	uint32_t samples;		/*!< Samples in the window */
+	uint32_t window_s;		/*!< RTC seconds covered by the window */
+	int32_t error_ppb;		/*!< Fitted frequency error, positive is fast */
+	int32_t drift_us;		/*!< Microseconds gained on the reference over the window */
+	int8_t old_offset;
+	int8_t new_offset;
+	HAL_StatusTypeDef status;	/*!< Result of writing the offset */
+} ds3231CalibrationStep;
+
+typedef void (*ds3231CalibrationLog)(void* context,
+		const ds3231CalibrationStep* step);
+
+typedef struct {
+	I2C_HandleTypeDef* port;
+
+	uint32_t min_window_s;
+	ds3231CalibrationLog log;
+	void* log_context;
+
+	int8_t offset;			/*!< Aging offset in the RTC */
+	uint32_t steps;
+
+	//fit of the current window, kept as running means and co-moments
+	uint32_t count;
+	uint32_t first_rtc;
+	uint64_t first_reference;
+	float mean_x;
+	float mean_y;
+	float m2_x;
+	float c_xy;
+} ds3231Calibration;
+
+/**
+ * @brief Reads the current aging offset and starts an empty window
+ *
+ * @param min_window_s - RTC seconds to collect before correcting, the
+ * error resolved is about 1/min_window_s seconds per second, so hours
+ * are needed for 0.1 ppm
+ * @param log - Called with every correction, may be NULL
+ **/
+HAL_StatusTypeDef DS3231_calibration_init(ds3231Calibration* cal,
+		I2C_HandleTypeDef *hi2c, uint32_t min_window_s,
+		ds3231CalibrationLog log, void* log_context);
+
+/**
+ * @brief Adds a sample, corrects the aging offset when the window is full
+ *
+ * @param reference_us - Reference time at the start of the RTC second
+ * @param rtc_seconds - RTC time that started, eg. from DS3231_time_to_epoch
+ **/
+HAL_StatusTypeDef DS3231_calibration_sample(ds3231Calibration* cal,
+		uint64_t reference_us, uint32_t rtc_seconds);
+
+/**
+ * @brief Frequency error fitted over the current window, positive is fast
+ **/
+int32_t DS3231_calibration_error_ppb(ds3231Calibration* cal);
+
+/**
+ * @brief Discards the current window, eg. after the RTC was set
+ **/
+void DS3231_calibration_reset(ds3231Calibration* cal);
+
+#endif /* DS3231_CALIBRATION_H_ */
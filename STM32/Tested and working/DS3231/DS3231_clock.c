@@ -0,0 +1,172 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Cached DS3231 clock advanced by the 1 Hz square wave
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+
+#include "DS3231_clock.h"
+
+static uint8_t days_in_month(uint8_t month, uint16_t year)
+{
+	static const uint8_t days[13] = {0, 31, 28, 31, 30, 31, 30, 31, 31, 30,
+			31, 30, 31};
+
+	if(month == FEBUARY && (year % 4 == 0) &&
+			((year % 100 != 0) || (year % 400 == 0)))
+		return 29;
+
+	return days[month];
+}
+
+//one second forward, rolling over the same way the RTC's counters do
+static void DS3231_clock_advance(ds3231Time* time)
+{
+	if(++time->sec < 60)
+		return;
+	time->sec = 0;
+
+	if(++time->min < 60)
+		return;
+	time->min = 0;
+
+	if(time->twelve_hour){
+		//12 AM, 1 AM ... 11 AM, 12 PM, 1 PM ... 11 PM
+		time->hour++;
+		if(time->hour == 13){
+			time->hour = 1;
+			return;
+		}
+		if(time->hour != 12)
+			return;
+		if(time->pm == AM){
+			time->pm = PM;
+			return;
+		}
+		time->pm = AM;
+	}else{
+		if(++time->hour < 24)
+			return;
+		time->hour = 0;
+	}
+
+	//new day
+	if(++time->week_day > SUNDAY)
+		time->week_day = MONDAY;
+
+	if(++time->date <= days_in_month(time->month, time->year))
+		return;
+	time->date = 1;
+
+	if(++time->month <= DECEMBER)
+		return;
+	time->month = JANUARY;
+	time->year++;
+}
+
+void DS3231_clock_tick(ds3231Clock* clock)
+{
+	clock->sequence++;
+	__DMB();
+
+	DS3231_clock_advance(&clock->time);
+
+	__DMB();
+	clock->sequence++;
+
+	clock->ticks++;
+}
+
+void DS3231_clock_get_time(ds3231Clock* clock, ds3231Time* time)
+{
+	uint32_t sequence;
+
+	//retry if an edge updated the time while it was being copied
+	do{
+		while((sequence = clock->sequence) & 1);
+		__DMB();
+		*time = clock->time;
+		__DMB();
+	}while(sequence != clock->sequence);
+}
+
+HAL_StatusTypeDef DS3231_clock_resync(ds3231Clock* clock)
+{
+	ds3231Time time;
+	uint32_t ticks = clock->ticks;
+	uint32_t primask;
+
+	if(DS3231_read_time(clock->port, &time) != HAL_OK)
+		return HAL_ERROR;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+
+	if(ticks != clock->ticks){
+		__set_PRIMASK(primask);
+		return HAL_BUSY;
+	}
+
+	clock->sequence++;
+	clock->time = time;
+	clock->sequence++;
+	clock->ticks = 0;
+
+	__set_PRIMASK(primask);
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef DS3231_clock_service(ds3231Clock* clock)
+{
+	if(!clock->resync_interval || clock->ticks < clock->resync_interval)
+		return HAL_OK;
+
+	return DS3231_clock_resync(clock);
+}
+
+HAL_StatusTypeDef DS3231_clock_init(ds3231Clock* clock, I2C_HandleTypeDef *hi2c,
+		uint32_t resync_interval)
+{
+	u08 control_register;
+
+	clock->port = hi2c;
+	clock->resync_interval = resync_interval;
+	clock->sequence = 0;
+	clock->ticks = 0;
+
+	if(HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, 0x0E, 1, &control_register, 1, 10)
+			!= HAL_OK)
+		return HAL_ERROR;
+
+	//INTCN low routes the square wave to the pin, RS2:RS1 = 00 is 1 Hz
+	control_register &= ~(1 << INTCN | 1 << RS1 | 1 << RS2);
+
+	if(HAL_I2C_Mem_Write(hi2c, DS3231_ADDR8, 0x0E, 1, &control_register, 1, 10)
+			!= HAL_OK)
+		return HAL_ERROR;
+
+	//no edges are counted yet so the first read always lands
+	return DS3231_clock_resync(clock);
+}
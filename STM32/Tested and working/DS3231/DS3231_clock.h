@@ -0,0 +1,104 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Cached DS3231 clock advanced by the 1 Hz square wave
+ *	
+ * The DS3231's INT#/SQW pin is set to a 1 Hz square wave and its falling
+ * edge, which coincides with the seconds register update, advances a copy
+ * of the time held in RAM. Reading the time is then a copy of a few bytes
+ * instead of an I2C transfer. The copy is resynchronised from the RTC
+ * every resync_interval seconds to catch missed edges.
+ *
+ * Using the pin as a square wave clears INTCN, so the alarms can no longer
+ * drive INT# while the cached clock is in use.
+ *
+ * Usage:
+ *	ds3231Clock clock;
+ *	DS3231_clock_init(&clock, &hi2c2, 3600);
+ *
+ *	void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)	//falling edge
+ *	{
+ *		if(GPIO_Pin == SQW_Pin)
+ *			DS3231_clock_tick(&clock);
+ *	}
+ *
+ *	//main loop
+ *	DS3231_clock_service(&clock);
+ *	DS3231_clock_get_time(&clock, &now);
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef DS3231_CLOCK_H_
+#define DS3231_CLOCK_H_
+
+#include "DS3231_stm32_hal.h"
+
+typedef struct {
+	I2C_HandleTypeDef* port;
+
+	ds3231Time time;			/*!< Only valid through DS3231_clock_get_time */
+	volatile uint32_t sequence;	/*!< Odd while time is being written */
+
+	volatile uint32_t ticks;	/*!< Edges since the last resync */
+	uint32_t resync_interval;	/*!< Seconds between resyncs, 0 never resyncs */
+} ds3231Clock;
+
+/**
+ * @brief Sets the square wave output to 1 Hz and loads the time from the RTC
+ *
+ * @param clock - Clock to initialise
+ * @param hi2c - I2C bus of the DS3231
+ * @param resync_interval - Seconds between resyncs, 0 to never resync
+ * @return HAL_OK if the RTC could be configured and read
+ **/
+HAL_StatusTypeDef DS3231_clock_init(ds3231Clock* clock, I2C_HandleTypeDef *hi2c,
+		uint32_t resync_interval);
+
+/**
+ * @brief Advances the cached time by one second, call on the falling edge
+ * of SQW
+ **/
+void DS3231_clock_tick(ds3231Clock* clock);
+
+/**
+ * @brief Copies the cached time, safe to call while DS3231_clock_tick runs
+ * in an interrupt
+ **/
+void DS3231_clock_get_time(ds3231Clock* clock, ds3231Time* time);
+
+/**
+ * @brief Reloads the time from the RTC
+ *
+ * The reload is discarded if an edge arrives during the I2C read, as the
+ * value read may then be a second old.
+ *
+ * @return HAL_OK if the time was reloaded
+ **/
+HAL_StatusTypeDef DS3231_clock_resync(ds3231Clock* clock);
+
+/**
+ * @brief Resyncs when resync_interval has elapsed, call from the main loop
+ **/
+HAL_StatusTypeDef DS3231_clock_service(ds3231Clock* clock);
+
+#endif /* DS3231_CLOCK_H_ */
@@ -0,0 +1,207 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Common RTC interface backend for the STM32 DS3231 library
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+
+#include "rtc.h"
+#include "DS3231_stm32_hal.h"
+
+static I2C_HandleTypeDef* rtc_port = NULL;
+
+static rtc_err_t rtc_read(u08 address, u08* data, u08 length)
+{
+	if(HAL_I2C_Mem_Read(rtc_port, DS3231_ADDR8, address, 1, data, length, 10)
+			!= HAL_OK)
+		return RTC_ERR_BUS;
+
+	return RTC_OK;
+}
+
+static rtc_err_t rtc_write(u08 address, u08* data, u08 length)
+{
+	if(HAL_I2C_Mem_Write(rtc_port, DS3231_ADDR8, address, 1, data, length, 10)
+			!= HAL_OK)
+		return RTC_ERR_BUS;
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_init(void* bus)
+{
+	rtc_port = (I2C_HandleTypeDef*)bus;
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_get_datetime(rtc_datetime_t* datetime)
+{
+	u08 raw[RTC_BCD_TIME_SIZE];
+
+	if(rtc_read(DS3231_SECONDS, raw, RTC_BCD_TIME_SIZE) != RTC_OK)
+		return RTC_ERR_BUS;
+
+	rtc_decode_bcd_time(raw, datetime);
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_set_datetime(const rtc_datetime_t* datetime)
+{
+	u08 raw[RTC_BCD_TIME_SIZE];
+
+	if(datetime->year < 2000 || datetime->year > 2099)
+		return RTC_ERR_RANGE;
+
+	rtc_encode_bcd_time(datetime, raw);
+	//century bit, DS3231_get_time reads years without it as 19xx
+	raw[5] |= 0x80;
+
+	return rtc_write(DS3231_SECONDS, raw, RTC_BCD_TIME_SIZE);
+}
+
+rtc_err_t rtc_get_epoch(uint32_t* epoch)
+{
+	rtc_datetime_t datetime;
+
+	if(rtc_get_datetime(&datetime) != RTC_OK)
+		return RTC_ERR_BUS;
+
+	*epoch = rtc_to_epoch(&datetime);
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_set_epoch(uint32_t epoch)
+{
+	rtc_datetime_t datetime;
+
+	rtc_from_epoch(epoch, &datetime);
+
+	return rtc_set_datetime(&datetime);
+}
+
+rtc_err_t rtc_set_alarm(uint32_t epoch)
+{
+	rtc_datetime_t datetime;
+	u08 alarm[4];
+	u08 control_register, status_register;
+	uint32_t now;
+
+	if(rtc_get_epoch(&now) != RTC_OK)
+		return RTC_ERR_BUS;
+
+	//the month and year are not matched, so the epoch has to be the next
+	//time its date and time come round or the alarm would fire early
+	if(epoch <= now || rtc_next_date_match(now, epoch) != epoch)
+		return RTC_ERR_RANGE;
+
+	rtc_from_epoch(epoch, &datetime);
+
+	//all mask bits clear, DY/DT clear: match date, hours, minutes, seconds
+	alarm[0] = rtc_dec2bcd(datetime.sec);
+	alarm[1] = rtc_dec2bcd(datetime.min);
+	alarm[2] = rtc_dec2bcd(datetime.hour);
+	alarm[3] = rtc_dec2bcd(datetime.date);
+
+	if(rtc_write(DS3231_ALARM1, alarm, 4) != RTC_OK)
+		return RTC_ERR_BUS;
+
+	if(rtc_read(DS3231_CONTROL, &control_register, 1) != RTC_OK ||
+			rtc_read(DS3231_STATUS, &status_register, 1) != RTC_OK)
+		return RTC_ERR_BUS;
+
+	status_register &= ~(1 << ALARM1_STATUS);
+	if(rtc_write(DS3231_STATUS, &status_register, 1) != RTC_OK)
+		return RTC_ERR_BUS;
+
+	control_register |= (1 << INTCN) | (1 << ALARM1_CRTL_ENABLE);
+
+	return rtc_write(DS3231_CONTROL, &control_register, 1);
+}
+
+rtc_err_t rtc_clear_alarm(void)
+{
+	u08 control_register, status_register;
+
+	if(rtc_read(DS3231_CONTROL, &control_register, 1) != RTC_OK ||
+			rtc_read(DS3231_STATUS, &status_register, 1) != RTC_OK)
+		return RTC_ERR_BUS;
+
+	control_register &= ~(1 << ALARM1_CRTL_ENABLE);
+	status_register &= ~(1 << ALARM1_STATUS);
+
+	if(rtc_write(DS3231_CONTROL, &control_register, 1) != RTC_OK)
+		return RTC_ERR_BUS;
+
+	return rtc_write(DS3231_STATUS, &status_register, 1);
+}
+
+rtc_err_t rtc_alarm_fired(uint8_t* fired)
+{
+	u08 status_register;
+
+	if(rtc_read(DS3231_STATUS, &status_register, 1) != RTC_OK)
+		return RTC_ERR_BUS;
+
+	*fired = (status_register >> ALARM1_STATUS) & 0x01;
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_get_temperature(int16_t* quarter_degrees)
+{
+	u08 raw[2];
+
+	if(rtc_read(DS3231_TEMP_MSB, raw, 2) != RTC_OK)
+		return RTC_ERR_BUS;
+
+	*quarter_degrees = (int16_t)((int8_t)raw[0]) * 4 + (raw[1] >> 6);
+
+	return RTC_OK;
+}
+
+uint8_t rtc_sram_size(void)
+{
+	return 0;
+}
+
+rtc_err_t rtc_read_sram(uint8_t offset, uint8_t* data, uint8_t length)
+{
+	(void)offset;
+	(void)data;
+	(void)length;
+
+	return RTC_ERR_UNSUPPORTED;
+}
+
+rtc_err_t rtc_write_sram(uint8_t offset, const uint8_t* data, uint8_t length)
+{
+	(void)offset;
+	(void)data;
+	(void)length;
+
+	return RTC_ERR_UNSUPPORTED;
+}
@@ -0,0 +1,265 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Software alarms multiplexed onto the DS3231's alarm 1
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+
+#include "DS3231_scheduler.h"
+
+#define HEAP_EPOCH(s, i)	((s)->alarms[(s)->heap[i]].epoch)
+
+static void heap_place(ds3231Scheduler* scheduler, u08 index, u08 id)
+{
+	scheduler->heap[index] = id;
+	scheduler->alarms[id].heap_index = index;
+}
+
+static void heap_sift_up(ds3231Scheduler* scheduler, u08 index)
+{
+	u08 id = scheduler->heap[index];
+	uint32_t epoch = scheduler->alarms[id].epoch;
+	u08 parent;
+
+	while(index){
+		parent = (index - 1) / 2;
+		if(HEAP_EPOCH(scheduler, parent) <= epoch)
+			break;
+		heap_place(scheduler, index, scheduler->heap[parent]);
+		index = parent;
+	}
+
+	heap_place(scheduler, index, id);
+}
+
+static void heap_sift_down(ds3231Scheduler* scheduler, u08 index)
+{
+	u08 id = scheduler->heap[index];
+	uint32_t epoch = scheduler->alarms[id].epoch;
+	u08 child;
+
+	while((child = 2 * index + 1) < scheduler->count){
+		if(child + 1 < scheduler->count &&
+				HEAP_EPOCH(scheduler, child + 1) < HEAP_EPOCH(scheduler, child))
+			child++;
+		if(epoch <= HEAP_EPOCH(scheduler, child))
+			break;
+		heap_place(scheduler, index, scheduler->heap[child]);
+		index = child;
+	}
+
+	heap_place(scheduler, index, id);
+}
+
+static void heap_push(ds3231Scheduler* scheduler, u08 id)
+{
+	heap_place(scheduler, scheduler->count, id);
+	heap_sift_up(scheduler, scheduler->count++);
+}
+
+static void heap_remove(ds3231Scheduler* scheduler, u08 index)
+{
+	u08 id = scheduler->heap[index];
+
+	scheduler->alarms[id].heap_index = DS3231_SCHEDULER_INVALID;
+
+	if(index == --scheduler->count)
+		return;
+
+	//move the last entry into the hole and restore the order around it
+	heap_place(scheduler, index, scheduler->heap[scheduler->count]);
+	heap_sift_down(scheduler, index);
+	heap_sift_up(scheduler, index);
+}
+
+static HAL_StatusTypeDef DS3231_scheduler_clear_flag(ds3231Scheduler* scheduler)
+{
+	u08 status_register;
+
+	if(HAL_I2C_Mem_Read(scheduler->port, DS3231_ADDR8, 0x0F, 1,
+			&status_register, 1, 10) != HAL_OK)
+		return HAL_ERROR;
+
+	if(!(status_register & (1 << ALARM1_STATUS)))
+		return HAL_OK;
+
+	status_register &= ~(1 << ALARM1_STATUS);
+
+	return HAL_I2C_Mem_Write(scheduler->port, DS3231_ADDR8, 0x0F, 1,
+			&status_register, 1, 10);
+}
+
+static HAL_StatusTypeDef DS3231_scheduler_program(ds3231Scheduler* scheduler, uint32_t epoch)
+{
+	ds3231Time time = {0};
+	ds3231Alarm alarm = {0};
+
+	DS3231_epoch_to_time(epoch, &time);
+
+	alarm.sec = time.sec;
+	alarm.min = time.min;
+	alarm.hour = time.hour;
+	alarm.date = time.date;
+	alarm.date_or_day = DAY_OF_MONTH;
+	alarm.alarm_type = ALARM_MATCH_DATE_OR_DAY;
+
+	//programmed is only recorded once the RTC holds it
+	if(DS3231_set_alarm(scheduler->port, &alarm, ALARM_ONE) != HAL_OK)
+		return HAL_ERROR;
+	if(!scheduler->programmed &&
+			DS3231_enable_alarms(scheduler->port, ALARM_ONE) != HAL_OK)
+		return HAL_ERROR;
+
+	scheduler->programmed = epoch;
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef DS3231_scheduler_init(ds3231Scheduler* scheduler,
+		I2C_HandleTypeDef *hi2c)
+{
+	u08 i;
+
+	scheduler->port = hi2c;
+	scheduler->count = 0;
+	scheduler->programmed = 0;
+	scheduler->pending = 0;
+
+	for(i = 0; i < DS3231_SCHEDULER_MAX_ALARMS; i++)
+		scheduler->alarms[i].heap_index = DS3231_SCHEDULER_INVALID;
+
+	DS3231_disable_alarms(hi2c, ALARM_ONE);
+	DS3231_enable_alarm_interrupt(hi2c);
+
+	return DS3231_scheduler_clear_flag(scheduler);
+}
+
+u08 DS3231_scheduler_add(ds3231Scheduler* scheduler, uint32_t epoch,
+		uint32_t period, ds3231AlarmCallback callback, void* context)
+{
+	ds3231SoftAlarm* alarm;
+	u08 id;
+
+	for(id = 0; id < DS3231_SCHEDULER_MAX_ALARMS; id++)
+		if(scheduler->alarms[id].heap_index == DS3231_SCHEDULER_INVALID)
+			break;
+
+	if(id == DS3231_SCHEDULER_MAX_ALARMS)
+		return DS3231_SCHEDULER_INVALID;
+
+	alarm = &scheduler->alarms[id];
+	alarm->epoch = epoch;
+	alarm->period = period;
+	alarm->callback = callback;
+	alarm->context = context;
+
+	heap_push(scheduler, id);
+
+	if(scheduler->heap[0] == id)
+		scheduler->pending = 1;
+
+	return id;
+}
+
+void DS3231_scheduler_cancel(ds3231Scheduler* scheduler, u08 id)
+{
+	if(id >= DS3231_SCHEDULER_MAX_ALARMS ||
+			scheduler->alarms[id].heap_index == DS3231_SCHEDULER_INVALID)
+		return;
+
+	heap_remove(scheduler, scheduler->alarms[id].heap_index);
+
+	scheduler->pending = 1;
+}
+
+void DS3231_scheduler_irq(ds3231Scheduler* scheduler)
+{
+	scheduler->pending = 1;
+}
+
+HAL_StatusTypeDef DS3231_scheduler_dispatch(ds3231Scheduler* scheduler)
+{
+	ds3231Time time;
+	ds3231SoftAlarm* alarm;
+	uint32_t now;
+	u08 id;
+
+	scheduler->pending = 0;
+
+	if(DS3231_scheduler_clear_flag(scheduler) != HAL_OK)
+		return HAL_ERROR;
+
+	//the time is read after clearing the flag, an alarm that comes due
+	//in between is run now instead of being missed
+	if(DS3231_read_time(scheduler->port, &time) != HAL_OK)
+		return HAL_ERROR;
+
+	now = DS3231_time_to_epoch(&time);
+
+	while(scheduler->count && HEAP_EPOCH(scheduler, 0) <= now){
+		id = scheduler->heap[0];
+		alarm = &scheduler->alarms[id];
+
+		heap_remove(scheduler, 0);
+
+		//periodic alarms are requeued first so that the callback can cancel them
+		if(alarm->period){
+			alarm->epoch += alarm->period;
+			if(alarm->epoch <= now)
+				alarm->epoch += ((now - alarm->epoch) / alarm->period + 1) *
+						alarm->period;
+			heap_push(scheduler, id);
+		}
+
+		if(alarm->callback != NULL)
+			alarm->callback(alarm->context);
+	}
+
+	if(!scheduler->count){
+		if(scheduler->programmed){
+			DS3231_disable_alarms(scheduler->port, ALARM_ONE);
+			scheduler->programmed = 0;
+		}
+		return HAL_OK;
+	}
+
+	//the date match also fires in earlier months, dispatch then just
+	//programs the same alarm again
+	if(HEAP_EPOCH(scheduler, 0) != scheduler->programmed){
+		//no INT# comes without the alarm, stay pending to retry
+		if(DS3231_scheduler_program(scheduler, HEAP_EPOCH(scheduler, 0)) != HAL_OK){
+			scheduler->pending = 1;
+			return HAL_ERROR;
+		}
+
+		//if the callbacks ran past the alarm it will not match until next
+		//month, dispatch again straight away instead
+		if(DS3231_read_time(scheduler->port, &time) != HAL_OK)
+			return HAL_ERROR;
+		if(DS3231_time_to_epoch(&time) >= scheduler->programmed)
+			scheduler->pending = 1;
+	}
+
+	return HAL_OK;
+}
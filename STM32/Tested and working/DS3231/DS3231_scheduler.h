@@ -0,0 +1,126 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Software alarms multiplexed onto the DS3231's alarm 1
+ *	
+ * Any number of software alarms (up to DS3231_SCHEDULER_MAX_ALARMS) are
+ * kept in a static pool ordered by a binary min-heap on their epoch time.
+ * Only the earliest is programmed into hardware alarm 1, as a full date,
+ * hour, minute and second match, so INT# only fires when something is
+ * due and the MCU can sleep in between.
+ *
+ * The INT# interrupt only marks the scheduler pending, the I2C traffic and
+ * the callbacks run from DS3231_scheduler_dispatch in thread context.
+ * Adding or cancelling alarms also marks the scheduler pending so that
+ * the hardware alarm is reprogrammed on the next dispatch.
+ *
+ * INT# is used for the alarm, which sets INTCN, so the scheduler can not
+ * be used together with the SQW based DS3231_clock.
+ *
+ * Usage:
+ *	ds3231Scheduler scheduler;
+ *	DS3231_scheduler_init(&scheduler, &hi2c2);
+ *	DS3231_scheduler_add(&scheduler, start, 600, log_callback, NULL);
+ *
+ *	void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)	//falling edge
+ *	{
+ *		if(GPIO_Pin == INT_Pin)
+ *			DS3231_scheduler_irq(&scheduler);
+ *	}
+ *
+ *	//main loop
+ *	if(scheduler.pending)
+ *		DS3231_scheduler_dispatch(&scheduler);
+ *	else
+ *		sleep until the next interrupt
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef DS3231_SCHEDULER_H_
+#define DS3231_SCHEDULER_H_
+
+#include "DS3231_stm32_hal.h"
+
+#define DS3231_SCHEDULER_MAX_ALARMS		32
+
+#define DS3231_SCHEDULER_INVALID		0xFF
+
+typedef void (*ds3231AlarmCallback)(void* context);
+
+typedef struct {
+	uint32_t epoch;		/*!< Next time the alarm is due */
+	uint32_t period;	/*!< Seconds between repeats, 0 for a single shot */
+	ds3231AlarmCallback callback;
+	void* context;
+	u08 heap_index;		/*!< Position in the heap, DS3231_SCHEDULER_INVALID if free */
+} ds3231SoftAlarm;
+
+typedef struct {
+	I2C_HandleTypeDef* port;
+
+	ds3231SoftAlarm alarms[DS3231_SCHEDULER_MAX_ALARMS];
+	u08 heap[DS3231_SCHEDULER_MAX_ALARMS];	/*!< Alarm ids, earliest first */
+	u08 count;
+
+	uint32_t programmed;	/*!< Epoch in hardware alarm 1, 0 if disabled */
+	volatile u08 pending;	/*!< Dispatch needed */
+} ds3231Scheduler;
+
+/**
+ * @brief Enables alarm 1 on INT# with no alarms scheduled
+ **/
+HAL_StatusTypeDef DS3231_scheduler_init(ds3231Scheduler* scheduler,
+		I2C_HandleTypeDef *hi2c);
+
+/**
+ * @brief Schedules a software alarm
+ *
+ * @param epoch - First time the alarm is due, seconds since 1970
+ * @param period - Seconds between repeats, 0 for a single shot
+ * @param callback - Called from DS3231_scheduler_dispatch
+ * @param context - Passed to the callback
+ * @return Alarm id, DS3231_SCHEDULER_INVALID if the pool is full
+ **/
+u08 DS3231_scheduler_add(ds3231Scheduler* scheduler, uint32_t epoch,
+		uint32_t period, ds3231AlarmCallback callback, void* context);
+
+/**
+ * @brief Removes a scheduled alarm, may be called from a callback
+ **/
+void DS3231_scheduler_cancel(ds3231Scheduler* scheduler, u08 id);
+
+/**
+ * @brief Marks the scheduler pending, call from the INT# interrupt
+ **/
+void DS3231_scheduler_irq(ds3231Scheduler* scheduler);
+
+/**
+ * @brief Runs the callbacks of all due alarms and programs the next one
+ * into the RTC
+ *
+ * @return HAL_ERROR if the I2C traffic failed, if the next alarm could not
+ * be programmed the scheduler stays pending so that it is tried again
+ **/
+HAL_StatusTypeDef DS3231_scheduler_dispatch(ds3231Scheduler* scheduler);
+
+#endif /* DS3231_SCHEDULER_H_ */
@@ -0,0 +1,179 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Shadow copy of the DS3231 register file
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+
+#include "DS3231_shadow.h"
+
+#define DS3231_SHADOW_ALL		((1ul << DS3231_REGISTER_COUNT) - 1)
+#define DS3231_SHADOW_READ_ONLY	((1ul << DS3231_TEMP_MSB) | (1ul << DS3231_TEMP_LSB))
+
+void DS3231_shadow_init(ds3231Shadow* shadow, I2C_HandleTypeDef *hi2c)
+{
+	u08 i;
+
+	shadow->port = hi2c;
+	shadow->dirty = 0;
+	shadow->flags_cleared = 0;
+
+	for(i = 0; i < DS3231_REGISTER_COUNT; i++)
+		shadow->registers[i] = 0;
+}
+
+HAL_StatusTypeDef DS3231_shadow_refresh(ds3231Shadow* shadow)
+{
+	u08 read_buffer[DS3231_REGISTER_COUNT];
+	u08 i;
+
+	if(!shadow->dirty)
+		return HAL_I2C_Mem_Read(shadow->port, DS3231_ADDR8, DS3231_SECONDS, 1,
+				shadow->registers, DS3231_REGISTER_COUNT, 10);
+
+	if(HAL_I2C_Mem_Read(shadow->port, DS3231_ADDR8, DS3231_SECONDS, 1,
+			read_buffer, DS3231_REGISTER_COUNT, 10) != HAL_OK)
+		return HAL_ERROR;
+
+	for(i = 0; i < DS3231_REGISTER_COUNT; i++)
+		if(!(shadow->dirty & (1ul << i)))
+			shadow->registers[i] = read_buffer[i];
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef DS3231_shadow_commit(ds3231Shadow* shadow)
+{
+	u08 alarm_flags = (1 << ALARM1_STATUS) | (1 << ALARM2_STATUS);
+	u08 status = shadow->registers[DS3231_STATUS];
+	u08 start = 0, end;
+	HAL_StatusTypeDef ret = HAL_OK;
+
+	//alarm flags can only be cleared, a 1 leaves them as they are
+	shadow->registers[DS3231_STATUS] |= alarm_flags & ~shadow->flags_cleared;
+
+	while(shadow->dirty & DS3231_SHADOW_ALL){
+		while(!(shadow->dirty & (1ul << start)))
+			start++;
+		for(end = start; end < DS3231_REGISTER_COUNT &&
+				(shadow->dirty & (1ul << end)); end++);
+
+		if(HAL_I2C_Mem_Write(shadow->port, DS3231_ADDR8, start, 1,
+				&shadow->registers[start], end - start, 10) != HAL_OK){
+			ret = HAL_ERROR;
+			break;
+		}
+
+		shadow->dirty &= ~(((1ul << end) - 1) & ~((1ul << start) - 1));
+		start = end;
+	}
+
+	shadow->registers[DS3231_STATUS] = status;
+	if(!(shadow->dirty & (1ul << DS3231_STATUS)))
+		shadow->flags_cleared = 0;
+
+	return ret;
+}
+
+void DS3231_shadow_write(ds3231Shadow* shadow, u08 address, u08 value)
+{
+	if(address >= DS3231_REGISTER_COUNT ||
+			(DS3231_SHADOW_READ_ONLY & (1ul << address)))
+		return;
+
+	shadow->registers[address] = value;
+	shadow->dirty |= 1ul << address;
+}
+
+void DS3231_shadow_modify(ds3231Shadow* shadow, u08 address, u08 mask,
+		u08 value)
+{
+	if(address >= DS3231_REGISTER_COUNT)
+		return;
+
+	DS3231_shadow_write(shadow, address,
+			(shadow->registers[address] & ~mask) | (value & mask));
+}
+
+void DS3231_shadow_get_time(ds3231Shadow* shadow, ds3231Time* time)
+{
+	DS3231_decode_time(&shadow->registers[DS3231_SECONDS], time);
+}
+
+void DS3231_shadow_set_time(ds3231Shadow* shadow, ds3231Time* time)
+{
+	u08 write_buffer[7];
+	u08 i;
+
+	DS3231_encode_time(time, write_buffer);
+
+	for(i = 0; i < 7; i++)
+		DS3231_shadow_write(shadow, DS3231_SECONDS + i, write_buffer[i]);
+}
+
+void DS3231_shadow_get_alarm(ds3231Shadow* shadow, ds3231Alarm* alarm,
+		ALARM_NUMBER alarm_number)
+{
+	u08 read_buffer[4];
+
+	if(alarm_number == ALARM_TWO){
+		//alarm 2 has no seconds register
+		read_buffer[0] = 0x00;
+		read_buffer[1] = shadow->registers[DS3231_ALARM2];
+		read_buffer[2] = shadow->registers[DS3231_ALARM2 + 1];
+		read_buffer[3] = shadow->registers[DS3231_ALARM2 + 2];
+		DS3231_decode_alarm(read_buffer, alarm);
+	}else
+		DS3231_decode_alarm(&shadow->registers[DS3231_ALARM1], alarm);
+}
+
+int16_t DS3231_shadow_get_temp(ds3231Shadow* shadow)
+{
+	//two's complement whole degrees, quarters in the top two bits of the LSB
+	return (int16_t)((int8_t)shadow->registers[DS3231_TEMP_MSB]) * 4 +
+			(shadow->registers[DS3231_TEMP_LSB] >> 6);
+}
+
+int8_t DS3231_shadow_get_aging(ds3231Shadow* shadow)
+{
+	return (int8_t)shadow->registers[DS3231_AGING];
+}
+
+void DS3231_shadow_set_aging(ds3231Shadow* shadow, int8_t offset)
+{
+	DS3231_shadow_write(shadow, DS3231_AGING, (u08)offset);
+}
+
+void DS3231_shadow_clear_alarms(ds3231Shadow* shadow, ALARM_NUMBER alarm_number)
+{
+	u08 mask = 0;
+
+	if(alarm_number == ALARM_ONE || alarm_number == BOTH)
+		mask |= 1 << ALARM1_STATUS;
+	if(alarm_number == ALARM_TWO || alarm_number == BOTH)
+		mask |= 1 << ALARM2_STATUS;
+
+	shadow->flags_cleared |= mask;
+	DS3231_shadow_modify(shadow, DS3231_STATUS, mask, 0x00);
+}
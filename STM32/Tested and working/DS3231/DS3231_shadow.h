@@ -0,0 +1,102 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Shadow copy of the DS3231 register file
+ *	
+ * All 19 registers are read with one burst by DS3231_shadow_refresh, so
+ * polling the time, alarms, status and temperature costs a single I2C
+ * transaction. The accessors decode from the raw copy only when called.
+ * Setters only change the copy and mark the registers dirty,
+ * DS3231_shadow_commit then writes each run of consecutive dirty
+ * registers with one transaction.
+ *
+ * Registers that are dirty keep their local value over a refresh, so
+ * changes are not lost if a refresh comes before the commit. When the
+ * status register is written, the alarm flags that were not cleared
+ * through DS3231_shadow_clear_alarms are written as 1, which leaves them
+ * unchanged, so a flag set since the last refresh is not lost.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef DS3231_SHADOW_H_
+#define DS3231_SHADOW_H_
+
+#include "DS3231_stm32_hal.h"
+
+typedef struct {
+	I2C_HandleTypeDef* port;
+
+	u08 registers[DS3231_REGISTER_COUNT];
+	uint32_t dirty;		/*!< Bit n set if register n has to be written */
+	u08 flags_cleared;	/*!< Alarm flags cleared since the last commit */
+} ds3231Shadow;
+
+void DS3231_shadow_init(ds3231Shadow* shadow, I2C_HandleTypeDef *hi2c);
+
+/**
+ * @brief Reads the whole register file in one transaction
+ **/
+HAL_StatusTypeDef DS3231_shadow_refresh(ds3231Shadow* shadow);
+
+/**
+ * @brief Writes the dirty registers, one transaction per consecutive run
+ **/
+HAL_StatusTypeDef DS3231_shadow_commit(ds3231Shadow* shadow);
+
+/**
+ * @brief Sets a register in the copy and marks it dirty
+ *
+ * The temperature registers are read only and are not changed.
+ **/
+void DS3231_shadow_write(ds3231Shadow* shadow, u08 address, u08 value);
+
+/**
+ * @brief Sets the bits of mask in a register to those of value
+ **/
+void DS3231_shadow_modify(ds3231Shadow* shadow, u08 address, u08 mask,
+		u08 value);
+
+static inline u08 DS3231_shadow_read(ds3231Shadow* shadow, u08 address)
+{
+	return shadow->registers[address];
+}
+
+void DS3231_shadow_get_time(ds3231Shadow* shadow, ds3231Time* time);
+void DS3231_shadow_set_time(ds3231Shadow* shadow, ds3231Time* time);
+void DS3231_shadow_get_alarm(ds3231Shadow* shadow, ds3231Alarm* alarm,
+		ALARM_NUMBER alarm_number);
+
+/**
+ * @brief Temperature in quarter degrees Celsius
+ **/
+int16_t DS3231_shadow_get_temp(ds3231Shadow* shadow);
+
+int8_t DS3231_shadow_get_aging(ds3231Shadow* shadow);
+void DS3231_shadow_set_aging(ds3231Shadow* shadow, int8_t offset);
+
+/**
+ * @brief Clears the given alarm flags in the status register
+ **/
+void DS3231_shadow_clear_alarms(ds3231Shadow* shadow, ALARM_NUMBER alarm_number);
+
+#endif /* DS3231_SHADOW_H_ */
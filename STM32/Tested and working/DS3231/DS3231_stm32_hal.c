@@ -28,33 +28,23 @@
 
 #include "DS3231_stm32_hal.h"
 
-uint8_t dec2bcd(uint8_t d)
-{
-  return ((d/10 * 16) + (d % 10));
-}
-
-uint8_t bcd2dec(uint8_t b)
-{
-  return ((b/16 * 10) + (b % 16));
-}
-
 void DS3231_set_time_short(I2C_HandleTypeDef *hi2c, u08 twelve_hour, u08 hour, u08 min, u08 sec){
 	u08 write_buffer[3];
-	write_buffer[0]= dec2bcd(sec);
-	write_buffer[1] = dec2bcd(min);
+	write_buffer[0]= rtc_dec2bcd(sec);
+	write_buffer[1] = rtc_dec2bcd(min);
 
 	if(twelve_hour){
 		write_buffer[2] |= (1 << TWELVE_FLAG);
 		if(hour >= 12){
 			write_buffer[2] |= (1 << PM_AM_FLAG);
-			write_buffer[2] |= dec2bcd((hour & 0x1F) - 12);
+			write_buffer[2] |= rtc_dec2bcd((hour & 0x1F) - 12);
 		}else{
 			write_buffer[2] &= ~(1 << PM_AM_FLAG);
-			write_buffer[2] |= dec2bcd(hour & 0x1F);
+			write_buffer[2] |= rtc_dec2bcd(hour & 0x1F);
 		}
 	}else{
 		write_buffer[2] &= ~(1 << TWELVE_FLAG);
-		write_buffer[2] |= dec2bcd(hour & 0x3F);
+		write_buffer[2] |= rtc_dec2bcd(hour & 0x3F);
 	}
 
 	HAL_I2C_Mem_Write(hi2c, DS3231_ADDR8, 0x00, 1, &write_buffer, 3, 10);
@@ -66,8 +56,8 @@ void DS3231_get_time_short(I2C_HandleTypeDef *hi2c,  u08* pm, u08* twelve_hour,
 
 	HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, 0x00, 1, &read_buffer, 3, 10);
 
-	*sec = bcd2dec(read_buffer[0]);
-	*min = bcd2dec(read_buffer[1]);
+	*sec = rtc_bcd2dec(read_buffer[0]);
+	*min = rtc_bcd2dec(read_buffer[1]);
 	return_hour = read_buffer[2];
 
 	if(return_hour & (1 << TWELVE_FLAG)){
@@ -76,16 +66,16 @@ void DS3231_get_time_short(I2C_HandleTypeDef *hi2c,  u08* pm, u08* twelve_hour,
 		if(return_hour & (1 << PM_AM_FLAG)){
 			//PM
 			*pm = TRUE;
-			*hour = bcd2dec(return_hour & 0x1F);
+			*hour = rtc_bcd2dec(return_hour & 0x1F);
 		}else{
 			//AM
 			*pm = FALSE;
-			*hour = bcd2dec(return_hour & 0x1F);
+			*hour = rtc_bcd2dec(return_hour & 0x1F);
 		}
 	}else{
 		//24 hour
 		*twelve_hour = FALSE;
-		*hour = bcd2dec(return_hour & 0x3F);
+		*hour = rtc_bcd2dec(return_hour & 0x3F);
 	}
 }
 
@@ -101,10 +91,10 @@ void DS3231_set_date_short(I2C_HandleTypeDef *hi2c, u16 year, u08 month, u08 dat
 		year -= 1900;
 	}
 
-	write_buffer[0] = dec2bcd(day);
-	write_buffer[1] = dec2bcd(date);
-	write_buffer[2] = dec2bcd(month) | century;
-	write_buffer[3] = dec2bcd(year);
+	write_buffer[0] = rtc_dec2bcd(day);
+	write_buffer[1] = rtc_dec2bcd(date);
+	write_buffer[2] = rtc_dec2bcd(month) | century;
+	write_buffer[3] = rtc_dec2bcd(year);
 
 	HAL_I2C_Mem_Write(hi2c, DS3231_ADDR8, 0x03, 1, &write_buffer, 4, 10);
 }
@@ -116,15 +106,15 @@ void DS3231_get_date_short(I2C_HandleTypeDef *hi2c, u16* year, u08* month, u08*
 	HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, 0x03, 1, &read_buffer, 4, 10);
 
 	century = ((read_buffer[2]&0x80)>>7);
-	*year = (century == 1 ? (2000 + bcd2dec(read_buffer[3])) : (1900 + bcd2dec(read_buffer[3])));
-	*month = bcd2dec(read_buffer[2]&0x1F);
-	*date = bcd2dec(read_buffer[1]&0x3F);
-	*day = bcd2dec(read_buffer[0]);
+	*year = (century == 1 ? (2000 + rtc_bcd2dec(read_buffer[3])) : (1900 + rtc_bcd2dec(read_buffer[3])));
+	*month = rtc_bcd2dec(read_buffer[2]&0x1F);
+	*date = rtc_bcd2dec(read_buffer[1]&0x3F);
+	*day = rtc_bcd2dec(read_buffer[0]);
 }
 
-void DS3231_set_time(I2C_HandleTypeDef *hi2c, ds3231Time* time){
-	u08 write_buffer[7];
-	u08 century = 0, year = time->year;
+void DS3231_encode_time(ds3231Time* time, u08* write_buffer){
+	u08 century = 0;
+	u16 year = time->year;
 	u08 hour;
 
 	if(time->year >= 2000){
@@ -139,41 +129,59 @@ void DS3231_set_time(I2C_HandleTypeDef *hi2c, ds3231Time* time){
 		//12 hour
 		if(time->pm == PM){
 			//PM
-			hour = dec2bcd(time->hour & 0x1F);
+			hour = rtc_dec2bcd(time->hour & 0x1F);
 			//set flags
 			hour |= (1 << PM_AM_FLAG) | (1 << TWELVE_FLAG) ;
 		}else{
 			//AM
-			hour = dec2bcd(time->hour & 0x1F);
+			hour = rtc_dec2bcd(time->hour & 0x1F);
 			//set flags
 			hour |= (1 << TWELVE_FLAG);
 			hour &= ~(1 << PM_AM_FLAG);
 		}
 	}else{
 		//24 hour
-		hour = dec2bcd(time->hour & 0x3F);
+		hour = rtc_dec2bcd(time->hour & 0x3F);
 		//set flags
 		hour &= ~(1 << TWELVE_FLAG);
 	}
 
-	write_buffer[0]=dec2bcd(time->sec);
-	write_buffer[1]=dec2bcd(time->min);
+	write_buffer[0]=rtc_dec2bcd(time->sec);
+	write_buffer[1]=rtc_dec2bcd(time->min);
 	write_buffer[2]=hour;
-	write_buffer[3]=dec2bcd(time->week_day);
-	write_buffer[4]=dec2bcd(time->date);
-	write_buffer[5]=(dec2bcd(time->month) | century);
-	write_buffer[6]=dec2bcd(year);
+	write_buffer[3]=rtc_dec2bcd(time->week_day);
+	write_buffer[4]=rtc_dec2bcd(time->date);
+	write_buffer[5]=(rtc_dec2bcd(time->month) | century);
+	write_buffer[6]=rtc_dec2bcd(year);
+}
 
-	HAL_I2C_Mem_Write(hi2c, DS3231_ADDR8, 0x00, 1, &write_buffer, 7, 10);
+void DS3231_set_time(I2C_HandleTypeDef *hi2c, ds3231Time* time){
+	u08 write_buffer[7];
+
+	DS3231_encode_time(time, write_buffer);
+
+	HAL_I2C_Mem_Write(hi2c, DS3231_ADDR8, 0x00, 1, write_buffer, 7, 10);
 }
 
 void DS3231_get_time(I2C_HandleTypeDef *hi2c, ds3231Time* return_struct){
+	DS3231_read_time(hi2c, return_struct);
+}
+
+HAL_StatusTypeDef DS3231_read_time(I2C_HandleTypeDef *hi2c, ds3231Time* return_struct){
 	u08 read_buffer[7];
+
+	if(HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, 0x00, 1, read_buffer, 7, 10) != HAL_OK)
+		return HAL_ERROR;
+
+	DS3231_decode_time(read_buffer, return_struct);
+
+	return HAL_OK;
+}
+
+void DS3231_decode_time(const u08* read_buffer, ds3231Time* return_struct){
 	u08 century = 0;
 	u08 hour_byte;
 
-	HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, 0x00, 1, &read_buffer, 7, 10);
-
 	hour_byte=read_buffer[2];
 
 	if(hour_byte & (1 << TWELVE_FLAG)){
@@ -186,41 +194,77 @@ void DS3231_get_time(I2C_HandleTypeDef *hi2c, ds3231Time* return_struct){
 			//AM
 			return_struct->pm = AM;
 		}
-		return_struct->hour = bcd2dec(hour_byte & 0x1F);
+		return_struct->hour = rtc_bcd2dec(hour_byte & 0x1F);
 	}else{
 		//24 hour
 		return_struct->twelve_hour = FALSE;
 		return_struct->pm = AM;
-		return_struct->hour = bcd2dec(hour_byte & 0x3F);
+		return_struct->hour = rtc_bcd2dec(hour_byte & 0x3F);
 	}
 
-	return_struct->sec=bcd2dec(read_buffer[0]);
-	return_struct->min=bcd2dec(read_buffer[1]);
-	return_struct->week_day=bcd2dec(read_buffer[3]);
-	return_struct->date=bcd2dec(read_buffer[4]);
-	return_struct->month=bcd2dec(read_buffer[5] & 0x1F);
+	return_struct->sec=rtc_bcd2dec(read_buffer[0]);
+	return_struct->min=rtc_bcd2dec(read_buffer[1]);
+	return_struct->week_day=rtc_bcd2dec(read_buffer[3]);
+	return_struct->date=rtc_bcd2dec(read_buffer[4]);
+	return_struct->month=rtc_bcd2dec(read_buffer[5] & 0x1F);
 	century = (read_buffer[5]&0x80) >> 7;
-	return_struct->year = century == 1 ? (2000 + bcd2dec(read_buffer[6])) : (1900 + bcd2dec(read_buffer[6]));
+	return_struct->year = century == 1 ? (2000 + rtc_bcd2dec(read_buffer[6])) : (1900 + rtc_bcd2dec(read_buffer[6]));
 }
 
-//untested
-float DS3231_get_temp(I2C_HandleTypeDef *hi2c){
-	float return_temp;
+uint32_t DS3231_time_to_epoch(ds3231Time* time){
+	rtc_datetime_t datetime;
 
-	u08 read_buffer[2];
+	datetime.year = time->year;
+	datetime.month = time->month;
+	datetime.date = time->date;
+	datetime.min = time->min;
+	datetime.sec = time->sec;
+
+	if(time->twelve_hour)
+		datetime.hour = (time->hour % 12) + (time->pm == PM ? 12 : 0);
+	else
+		datetime.hour = time->hour;
 
-	HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, 0x11, 1, &read_buffer, 2, 10);
+	return rtc_to_epoch(&datetime);
+}
+
+//keeps the 12/24 hour mode already set in time
+void DS3231_epoch_to_time(uint32_t epoch, ds3231Time* time){
+	rtc_datetime_t datetime;
 
-	read_buffer[1] = (read_buffer[1] >> 6) * 25;
+	rtc_from_epoch(epoch, &datetime);
 
-	return return_temp = ((((short)read_buffer[0] << 8) | (short)read_buffer[1]) >> 6) / 4.0f;
+	time->sec = datetime.sec;
+	time->min = datetime.min;
+	time->week_day = datetime.week_day;
+	time->date = datetime.date;
+	time->month = datetime.month;
+	time->year = datetime.year;
 
+	if(time->twelve_hour){
+		time->pm = (datetime.hour >= 12) ? PM : AM;
+		time->hour = (datetime.hour % 12) ? (datetime.hour % 12) : 12;
+	}else{
+		time->pm = AM;
+		time->hour = datetime.hour;
+	}
+}
+
+//last value of the 64 second automatic conversion, see DS3231_temperature for
+//on demand conversions
+float DS3231_get_temp(I2C_HandleTypeDef *hi2c){
+	u08 read_buffer[2];
+
+	HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, DS3231_TEMP_MSB, 1, read_buffer, 2, 10);
+
+	//two's complement whole degrees, quarters in the top two bits of the LSB
+	return (int8_t)read_buffer[0] + (read_buffer[1] >> 6) * 0.25f;
 }
 
 void DS3231_register_dump(I2C_HandleTypeDef *hi2c, ds3231Registers* return_struct){
-		u08 read_buffer[19];
+		u08 read_buffer[DS3231_REGISTER_COUNT];
 
-		HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, 0x00, 1, &read_buffer, 20, 10);
+		HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, 0x00, 1, read_buffer, DS3231_REGISTER_COUNT, 10);
 
 		return_struct->sec = read_buffer[0];
         return_struct->min = read_buffer[1];
@@ -245,29 +289,29 @@ void DS3231_register_dump(I2C_HandleTypeDef *hi2c, ds3231Registers* return_struc
 
 //untested
 void DS3231_set_alarm_short(I2C_HandleTypeDef *hi2c, u08 twelve_hour, u08 hour, u08 min, u08 sec, ALARM_NUMBER alarm_number){
-	u08 write_buffer[3];
-	write_buffer[0]= dec2bcd(sec);
-	write_buffer[1] = dec2bcd(min);
+	u08 write_buffer[3] = {0};
+	write_buffer[0]= rtc_dec2bcd(sec);
+	write_buffer[1] = rtc_dec2bcd(min);
 
 	if(twelve_hour){
 		write_buffer[2] |= (1 << TWELVE_FLAG);
 		if(hour >= 12){
 			write_buffer[2] |= (1 << PM_AM_FLAG);
-			write_buffer[2] |= dec2bcd((hour & 0x1F) - 12);
+			write_buffer[2] |= rtc_dec2bcd((hour & 0x1F) - 12);
 		}else{
 			write_buffer[2] &= ~(1 << PM_AM_FLAG);
-			write_buffer[2] |= dec2bcd(hour & 0x1F);
+			write_buffer[2] |= rtc_dec2bcd(hour & 0x1F);
 		}
 	}else{
 		write_buffer[2] &= ~(1 << TWELVE_FLAG);
-		write_buffer[2] |= dec2bcd(hour & 0x3F);
+		write_buffer[2] |= rtc_dec2bcd(hour & 0x3F);
 	}
 
 	HAL_I2C_Mem_Write(hi2c, DS3231_ADDR8, 0x07, 1, &write_buffer, 3, 10);
 }
 
 //untested
-void DS3231_set_alarm(I2C_HandleTypeDef *hi2c, ds3231Alarm* alarm_time, ALARM_NUMBER alarm_number){
+HAL_StatusTypeDef DS3231_set_alarm(I2C_HandleTypeDef *hi2c, ds3231Alarm* alarm_time, ALARM_NUMBER alarm_number){
 	u08 alarm_register_addr = 0x07;
 
 	switch(alarm_number){
@@ -276,12 +320,15 @@ void DS3231_set_alarm(I2C_HandleTypeDef *hi2c, ds3231Alarm* alarm_time, ALARM_NU
 		break;
 	case ALARM_TWO:
 		alarm_register_addr = 0x0B;
+		break;
+	default:
+		return HAL_ERROR;
 	}
 
 	u08 write_buffer[4];
 
-	write_buffer[0] = dec2bcd(alarm_time->sec) & 0x7F;
-	write_buffer[1] = dec2bcd(alarm_time->min) & 0x7F;
+	write_buffer[0] = rtc_dec2bcd(alarm_time->sec) & 0x7F;
+	write_buffer[1] = rtc_dec2bcd(alarm_time->min) & 0x7F;
 
 	write_buffer[2] = 0x00;
 
@@ -289,18 +336,18 @@ void DS3231_set_alarm(I2C_HandleTypeDef *hi2c, ds3231Alarm* alarm_time, ALARM_NU
 		//12 hour
 		if(alarm_time->pm == PM){
 			//PM
-			write_buffer[2] = bcd2dec(alarm_time->hour & 0x1F);
+			write_buffer[2] = rtc_dec2bcd(alarm_time->hour & 0x1F);
 			write_buffer[2] |= (1 << PM_AM_FLAG) | (1 << TWELVE_FLAG) ;
 		}else{
 			//AM
-			write_buffer[2] = dec2bcd(alarm_time->hour & 0x1F);
+			write_buffer[2] = rtc_dec2bcd(alarm_time->hour & 0x1F);
 			//set flags
 			write_buffer[2] |= (1 << TWELVE_FLAG);
 			write_buffer[2] &= ~(1 << PM_AM_FLAG);
 		}
 	}else{
 		//24 hours
-		write_buffer[2] = dec2bcd(alarm_time->hour & 0x3F);
+		write_buffer[2] = rtc_dec2bcd(alarm_time->hour & 0x3F);
 		//set flags
 		write_buffer[2] &= ~(1 << TWELVE_FLAG);
 	}
@@ -309,12 +356,12 @@ void DS3231_set_alarm(I2C_HandleTypeDef *hi2c, ds3231Alarm* alarm_time, ALARM_NU
 
 	if(alarm_time->date_or_day == DAY_OF_MONTH){
 		//Day of month
-		day_date_byte |= (1<<DY_DT_FLAG);
-		day_date_byte |= dec2bcd(alarm_time->date & 0x3F);
+		day_date_byte &= ~(1<<DY_DT_FLAG);
+		day_date_byte |= rtc_dec2bcd(alarm_time->date & 0x3F);
 	}else{
 		//Day of week
-		day_date_byte &= ~(1<<DY_DT_FLAG);
-		day_date_byte |= dec2bcd(alarm_time->week_day & 0x0F);
+		day_date_byte |= (1<<DY_DT_FLAG);
+		day_date_byte |= rtc_dec2bcd(alarm_time->week_day & 0x0F);
 	}
 
 	write_buffer[3] = day_date_byte;
@@ -354,14 +401,19 @@ void DS3231_set_alarm(I2C_HandleTypeDef *hi2c, ds3231Alarm* alarm_time, ALARM_NU
 		break;
 	}
 
-	HAL_I2C_Mem_Write(hi2c, DS3231_ADDR8, alarm_register_addr, 1, &write_buffer, 4, 10);
+	//alarm 2 has no seconds register
+	if(alarm_number == ALARM_TWO)
+		return HAL_I2C_Mem_Write(hi2c, DS3231_ADDR8, alarm_register_addr, 1, &write_buffer[1], 3, 10);
+	else
+		return HAL_I2C_Mem_Write(hi2c, DS3231_ADDR8, alarm_register_addr, 1, write_buffer, 4, 10);
 }
 
 //untested
-void DS3231_enable_alarms(I2C_HandleTypeDef *hi2c, ALARM_NUMBER alarm_number){
+HAL_StatusTypeDef DS3231_enable_alarms(I2C_HandleTypeDef *hi2c, ALARM_NUMBER alarm_number){
 	u08 control_register = 0x00;
 
-	HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, 0x0E, 1, &control_register, 1, 10);
+	if(HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, 0x0E, 1, &control_register, 1, 10) != HAL_OK)
+		return HAL_ERROR;
 
 	switch(alarm_number){
 	case ALARM_ONE:
@@ -378,7 +430,7 @@ void DS3231_enable_alarms(I2C_HandleTypeDef *hi2c, ALARM_NUMBER alarm_number){
 		break;
 	}
 
-	HAL_I2C_Mem_Write(hi2c, DS3231_ADDR8, 0x0E, 1, &control_register, 1, 10);
+	return HAL_I2C_Mem_Write(hi2c, DS3231_ADDR8, 0x0E, 1, &control_register, 1, 10);
 }
 
 //untested
@@ -470,12 +522,26 @@ void DS3231_get_alarm(I2C_HandleTypeDef *hi2c, ds3231Alarm* return_struct, ALARM
 	case ALARM_TWO:
 		alarm_register_addr = 0x0B;
 		break;
+	default:
+		return;
 	}
 
-	HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, alarm_register_addr, 1, &read_buffer, 4, 10);
+	if(alarm_number == ALARM_TWO){
+		read_buffer[0] = 0x00;
+		HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, alarm_register_addr, 1, &read_buffer[1], 3, 10);
+	}else
+		HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, alarm_register_addr, 1, read_buffer, 4, 10);
+
+	DS3231_decode_alarm(read_buffer, return_struct);
+}
+
+//read_buffer holds seconds, minutes, hours and day/date of the alarm
+void DS3231_decode_alarm(const u08* read_buffer, ds3231Alarm* return_struct){
+	u08 masks = 0;
+	u08 i;
 
-	return_struct->sec=bcd2dec(read_buffer[0] & 0x7F);
-	return_struct->min=bcd2dec(read_buffer[1] & 0x7F);
+	return_struct->sec=rtc_bcd2dec(read_buffer[0] & 0x7F);
+	return_struct->min=rtc_bcd2dec(read_buffer[1] & 0x7F);
 
 	if(read_buffer[2] & (1 << TWELVE_FLAG)){
 		//12 hour
@@ -487,22 +553,44 @@ void DS3231_get_alarm(I2C_HandleTypeDef *hi2c, ds3231Alarm* return_struct, ALARM
 			//AM
 			return_struct->pm = AM;
 		}
-		return_struct->hour = bcd2dec(read_buffer[2] & 0x1F);
+		return_struct->hour = rtc_bcd2dec(read_buffer[2] & 0x1F);
 	}else{
 		//24 hour
 		return_struct->twelve_hour = FALSE;
 		return_struct->pm = AM;
-		return_struct->hour = bcd2dec(read_buffer[2] & 0x3F);
+		return_struct->hour = rtc_bcd2dec(read_buffer[2] & 0x3F);
 	}
 
 	if(read_buffer[3] & (1 << DY_DT_FLAG)){
-		//day of month
-		return_struct->date_or_day = DAY_OF_MONTH;
-		return_struct->date = bcd2dec(read_buffer[3] & 0x3F);
-	}else{
 		//day of week
 		return_struct->date_or_day = DAY_OF_WEEK;
-		return_struct->week_day = bcd2dec(read_buffer[3] & 0x0F);
+		return_struct->week_day = rtc_bcd2dec(read_buffer[3] & 0x0F);
+	}else{
+		//day of month
+		return_struct->date_or_day = DAY_OF_MONTH;
+		return_struct->date = rtc_bcd2dec(read_buffer[3] & 0x3F);
+	}
+
+	//A1M1-A1M4, a set mask bit means the register is ignored
+	for(i = 0; i < 4; i++)
+		masks |= ((read_buffer[i] >> ALARM_MASK_BITS) & 0x01) << i;
+
+	switch(masks){
+	case 0x0F:
+		return_struct->alarm_type = ALARM_EVERY_SECOND;
+		break;
+	case 0x0E:
+		return_struct->alarm_type = ALARM_MATCH_SECONDS;
+		break;
+	case 0x0C:
+		return_struct->alarm_type = ALARM_MATCH_MINUTES;
+		break;
+	case 0x08:
+		return_struct->alarm_type = ALARM_MATCH_HOURS;
+		break;
+	default:
+		return_struct->alarm_type = ALARM_MATCH_DATE_OR_DAY;
+		break;
 	}
 }
 
@@ -512,7 +600,7 @@ void DS3231_stop_triggered_alarms(I2C_HandleTypeDef *hi2c){
 
 	HAL_I2C_Mem_Read(hi2c, DS3231_ADDR8, 0x0F, 1, &status_register, 1, 10);
 
-	status_register &= ~(1 << ALARM1_STATUS | 1 << ALARM1_STATUS);
+	status_register &= ~(1 << ALARM1_STATUS | 1 << ALARM2_STATUS);
 
 	HAL_I2C_Mem_Write(hi2c, DS3231_ADDR8, 0x0F, 1, &status_register, 1, 10);
 }
@@ -30,6 +30,7 @@
 
 #include "main.h"
 #include "stm32f4xx_hal.h"
+#include "rtc_codec.h"
 
 #ifndef u08
 #define u08 uint8_t
@@ -42,6 +43,18 @@
 
 #define STM_I2C_PORT	hi2c2
 
+//register addresses
+#define DS3231_SECONDS		0x00
+#define DS3231_ALARM1		0x07
+#define DS3231_ALARM2		0x0B
+#define DS3231_CONTROL		0x0E
+#define DS3231_STATUS		0x0F
+#define DS3231_AGING		0x10
+#define DS3231_TEMP_MSB		0x11
+#define DS3231_TEMP_LSB		0x12
+
+#define DS3231_REGISTER_COUNT	19
+
 #ifndef TRUE
 #define TRUE			1
 #endif
@@ -126,6 +139,10 @@ typedef struct {
 #define ALARM2_STATUS				1
 #define ALARM1_STATUS				0
 
+#define INTCN						2
+#define CONV						5
+#define BSY							2
+
 #define RS1							3
 #define RS2							4
 
@@ -137,15 +154,28 @@ typedef struct {
 #define u16 uint16_t
 #endif
 
-uint8_t dec2bcd(uint8_t d);
-uint8_t bcd2dec(uint8_t b);
 void DS3231_set_time_short(I2C_HandleTypeDef *hi2c, u08 twelve_hour, u08 hour, u08 min, u08 sec);
 void DS3231_get_time_short(I2C_HandleTypeDef *hi2c, u08* pm, u08* twelve_hour, u08* hour, u08*min, u08* sec);
 void DS3231_set_date_short(I2C_HandleTypeDef *hi2c, u16 year, u08 month, u08 date, u08 day);
 void DS3231_get_date_short(I2C_HandleTypeDef *hi2c, u16* year, u08* month, u08* date, u08* day);
 void DS3231_set_time(I2C_HandleTypeDef *hi2c, ds3231Time* time);
 void DS3231_get_time(I2C_HandleTypeDef *hi2c, ds3231Time* return_struct);
+HAL_StatusTypeDef DS3231_read_time(I2C_HandleTypeDef *hi2c, ds3231Time* return_struct);
+void DS3231_encode_time(ds3231Time* time, u08* write_buffer);
+void DS3231_decode_time(const u08* read_buffer, ds3231Time* return_struct);
+void DS3231_decode_alarm(const u08* read_buffer, ds3231Alarm* return_struct);
+uint32_t DS3231_time_to_epoch(ds3231Time* time);
+void DS3231_epoch_to_time(uint32_t epoch, ds3231Time* time);
 float DS3231_get_temp(I2C_HandleTypeDef *hi2c);
 void DS3231_register_dump(I2C_HandleTypeDef *hi2c, ds3231Registers* return_struct);
+void DS3231_set_alarm_short(I2C_HandleTypeDef *hi2c, u08 twelve_hour, u08 hour, u08 min, u08 sec, ALARM_NUMBER alarm_number);
+HAL_StatusTypeDef DS3231_set_alarm(I2C_HandleTypeDef *hi2c, ds3231Alarm* alarm_time, ALARM_NUMBER alarm_number);
+void DS3231_get_alarm(I2C_HandleTypeDef *hi2c, ds3231Alarm* return_struct, ALARM_NUMBER alarm_number);
+HAL_StatusTypeDef DS3231_enable_alarms(I2C_HandleTypeDef *hi2c, ALARM_NUMBER alarm_number);
+void DS3231_disable_alarms(I2C_HandleTypeDef *hi2c, ALARM_NUMBER alarm_number);
+void DS3231_enable_alarm_interrupt(I2C_HandleTypeDef *hi2c);
+void DS3231_disable_alarm_interrupt(I2C_HandleTypeDef *hi2c);
+void DS3231_change_wave_freq(I2C_HandleTypeDef *hi2c, WAVE_FREQ frequency);
+void DS3231_stop_triggered_alarms(I2C_HandleTypeDef *hi2c);
 
 #endif /* DS3231_STM32_ALEX_H_ */
@@ -0,0 +1,168 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Non-blocking DS3231 temperature conversions
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+
+#include "DS3231_temperature.h"
+
+#define RING_MASK	(DS3231_TEMPERATURE_SAMPLES - 1)
+
+void DS3231_temperature_init(ds3231Temperature* temp, I2C_HandleTypeDef *hi2c,
+		uint32_t poll_ms, uint32_t period_ms)
+{
+	temp->port = hi2c;
+	temp->state = DS3231_TEMPERATURE_IDLE;
+	temp->poll_ms = poll_ms;
+	temp->period_ms = period_ms;
+	temp->head = 0;
+	temp->tail = 0;
+	temp->overruns = 0;
+}
+
+HAL_StatusTypeDef DS3231_temperature_start(ds3231Temperature* temp)
+{
+	HAL_StatusTypeDef ret;
+
+	if(temp->state != DS3231_TEMPERATURE_IDLE &&
+			temp->state != DS3231_TEMPERATURE_ERROR)
+		return HAL_BUSY;
+
+	temp->start_tick = HAL_GetTick();
+	temp->state = DS3231_TEMPERATURE_READ_CONTROL;
+
+	ret = HAL_I2C_Mem_Read_IT(temp->port, DS3231_ADDR8, DS3231_CONTROL, 1,
+			temp->buffer, 2);
+	if(ret != HAL_OK)
+		temp->state = DS3231_TEMPERATURE_ERROR;
+
+	return ret;
+}
+
+static void DS3231_temperature_poll(ds3231Temperature* temp)
+{
+	temp->state = DS3231_TEMPERATURE_POLL;
+
+	if(HAL_I2C_Mem_Read_IT(temp->port, DS3231_ADDR8, DS3231_CONTROL, 1,
+			temp->buffer, sizeof(temp->buffer)) != HAL_OK)
+		//bus busy with something else, try again on the next poll
+		temp->state = DS3231_TEMPERATURE_WAIT;
+}
+
+void DS3231_temperature_service(ds3231Temperature* temp)
+{
+	uint32_t now = HAL_GetTick();
+
+	switch(temp->state){
+	case DS3231_TEMPERATURE_WAIT:
+		if(now - temp->poll_tick >= temp->poll_ms)
+			DS3231_temperature_poll(temp);
+		break;
+	case DS3231_TEMPERATURE_IDLE:
+	case DS3231_TEMPERATURE_ERROR:
+		if(temp->period_ms && now - temp->start_tick >= temp->period_ms)
+			DS3231_temperature_start(temp);
+		break;
+	default:
+		break;
+	}
+}
+
+static void DS3231_temperature_push(ds3231Temperature* temp, int16_t sample)
+{
+	u08 next = (temp->head + 1) & RING_MASK;
+
+	//only the reader moves tail, so when full the new sample is dropped
+	if(next == temp->tail){
+		temp->overruns++;
+		return;
+	}
+
+	temp->samples[temp->head] = sample;
+	temp->head = next;
+}
+
+void DS3231_temperature_rx_complete(ds3231Temperature* temp)
+{
+	u08 control = temp->buffer[0];
+	u08 status = temp->buffer[1];
+
+	switch(temp->state){
+	case DS3231_TEMPERATURE_READ_CONTROL:
+		temp->poll_tick = HAL_GetTick();
+		//a conversion is already running, automatic or one of ours
+		if((control & (1 << CONV)) || (status & (1 << BSY))){
+			temp->state = DS3231_TEMPERATURE_WAIT;
+			break;
+		}
+		temp->buffer[0] = control | (1 << CONV);
+		temp->state = DS3231_TEMPERATURE_WRITE_CONTROL;
+		if(HAL_I2C_Mem_Write_IT(temp->port, DS3231_ADDR8, DS3231_CONTROL, 1,
+				temp->buffer, 1) != HAL_OK)
+			temp->state = DS3231_TEMPERATURE_ERROR;
+		break;
+	case DS3231_TEMPERATURE_POLL:
+		temp->poll_tick = HAL_GetTick();
+		//CONV clears when our conversion ends, but an automatic one may
+		//still hold BSY and the temperature registers are only valid after
+		if((control & (1 << CONV)) || (status & (1 << BSY))){
+			temp->state = DS3231_TEMPERATURE_WAIT;
+			break;
+		}
+		DS3231_temperature_push(temp,
+				(int16_t)((int8_t)temp->buffer[3]) * 4 + (temp->buffer[4] >> 6));
+		temp->state = DS3231_TEMPERATURE_IDLE;
+		break;
+	default:
+		break;
+	}
+}
+
+void DS3231_temperature_tx_complete(ds3231Temperature* temp)
+{
+	if(temp->state != DS3231_TEMPERATURE_WRITE_CONTROL)
+		return;
+
+	temp->poll_tick = HAL_GetTick();
+	temp->state = DS3231_TEMPERATURE_WAIT;
+}
+
+void DS3231_temperature_error(ds3231Temperature* temp)
+{
+	if(temp->state != DS3231_TEMPERATURE_IDLE)
+		temp->state = DS3231_TEMPERATURE_ERROR;
+}
+
+u08 DS3231_temperature_read(ds3231Temperature* temp, int16_t* samples, u08 max)
+{
+	u08 count = 0;
+
+	while(count < max && temp->tail != temp->head){
+		samples[count++] = temp->samples[temp->tail];
+		temp->tail = (temp->tail + 1) & RING_MASK;
+	}
+
+	return count;
+}
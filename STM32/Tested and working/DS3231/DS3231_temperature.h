@@ -0,0 +1,133 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Non-blocking DS3231 temperature conversions
+ *	
+ * The DS3231 only updates its temperature registers every 64 seconds on
+ * its own. DS3231_temperature_start forces a conversion by setting CONV
+ * and the result is collected without ever waiting on the bus: all
+ * transfers use the interrupt driven HAL_I2C_Mem_Read_IT and
+ * HAL_I2C_Mem_Write_IT, and DS3231_temperature_service polls CONV and BSY
+ * every poll_ms until the conversion, which takes up to 200 ms, and any
+ * automatic one running alongside it have finished.
+ * Samples, in quarter degrees Celsius, are stored in a ring buffer.
+ *
+ * Usage:
+ *	ds3231Temperature temp;
+ *	DS3231_temperature_init(&temp, &hi2c2, 10, 1000);	//one sample a second
+ *	DS3231_temperature_start(&temp);
+ *
+ *	void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+ *	{
+ *		if(hi2c == temp.port)
+ *			DS3231_temperature_rx_complete(&temp);
+ *	}
+ *	void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+ *	{
+ *		if(hi2c == temp.port)
+ *			DS3231_temperature_tx_complete(&temp);
+ *	}
+ *	void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+ *	{
+ *		if(hi2c == temp.port)
+ *			DS3231_temperature_error(&temp);
+ *	}
+ *
+ *	//main loop
+ *	DS3231_temperature_service(&temp);
+ *	while(DS3231_temperature_read(&temp, &sample, 1))
+ *		...
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef DS3231_TEMPERATURE_H_
+#define DS3231_TEMPERATURE_H_
+
+#include "DS3231_stm32_hal.h"
+
+/** Ring buffer size, must be a power of two */
+#define DS3231_TEMPERATURE_SAMPLES	16
+
+typedef enum {
+	DS3231_TEMPERATURE_IDLE,
+	DS3231_TEMPERATURE_READ_CONTROL,	/*!< Reading control and status */
+	DS3231_TEMPERATURE_WRITE_CONTROL,	/*!< Setting CONV */
+	DS3231_TEMPERATURE_WAIT,			/*!< Converting, waiting to poll */
+	DS3231_TEMPERATURE_POLL,			/*!< Reading control to temperature */
+	DS3231_TEMPERATURE_ERROR
+} ds3231TemperatureState;
+
+typedef struct {
+	I2C_HandleTypeDef* port;
+
+	volatile ds3231TemperatureState state;
+	u08 buffer[5];			/*!< Control, status, aging, temperature MSB and LSB */
+
+	uint32_t poll_ms;		/*!< Time between CONV and BSY polls */
+	uint32_t period_ms;		/*!< Time between conversions, 0 for one per start */
+	uint32_t poll_tick;
+	uint32_t start_tick;
+
+	int16_t samples[DS3231_TEMPERATURE_SAMPLES];	/*!< Quarter degrees Celsius */
+	volatile u08 head;
+	volatile u08 tail;
+	u08 overruns;			/*!< Samples dropped because the buffer was full */
+} ds3231Temperature;
+
+/**
+ * @param temp - Conversion state
+ * @param hi2c - I2C bus of the DS3231
+ * @param poll_ms - Time between polls of CONV and BSY while converting
+ * @param period_ms - Time between conversions, 0 to only convert when
+ * started
+ **/
+void DS3231_temperature_init(ds3231Temperature* temp, I2C_HandleTypeDef *hi2c,
+		uint32_t poll_ms, uint32_t period_ms);
+
+/**
+ * @brief Starts a conversion
+ *
+ * @return HAL_BUSY if a conversion is running, otherwise the result of
+ * starting the first transfer
+ **/
+HAL_StatusTypeDef DS3231_temperature_start(ds3231Temperature* temp);
+
+/**
+ * @brief Polls a running conversion and starts periodic ones, never waits
+ **/
+void DS3231_temperature_service(ds3231Temperature* temp);
+
+void DS3231_temperature_rx_complete(ds3231Temperature* temp);
+void DS3231_temperature_tx_complete(ds3231Temperature* temp);
+void DS3231_temperature_error(ds3231Temperature* temp);
+
+/**
+ * @brief Takes the oldest samples out of the ring buffer
+ *
+ * @param samples - Quarter degrees Celsius
+ * @param max - Number of samples that fit in samples
+ * @return Number of samples copied
+ **/
+u08 DS3231_temperature_read(ds3231Temperature* temp, int16_t* samples, u08 max);
+
+#endif /* DS3231_TEMPERATURE_H_ */
@@ -0,0 +1,124 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Microsecond timestamps from the DS3231 1 Hz edge and a free running timer
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+
+#include "DS3231_timestamp.h"
+
+static void DS3231_timestamp_set_rate(ds3231Timestamp* stamp, uint32_t rate_q4)
+{
+	stamp->rate_q4 = rate_q4;
+	//(10^6 << 32) / (rate_q4 / 16), done once a second so that reads only multiply
+	stamp->us_per_tick_q32 = (1000000ull << 36) / rate_q4;
+}
+
+void DS3231_timestamp_init(ds3231Timestamp* stamp, TIM_HandleTypeDef* timer,
+		uint32_t timer_hz)
+{
+	stamp->timer = timer;
+	stamp->nominal_hz = timer_hz;
+	stamp->sequence = 0;
+	stamp->edge_count = 0;
+	stamp->seconds = 0;
+	stamp->edges = 0;
+	DS3231_timestamp_set_rate(stamp, timer_hz << 4);
+}
+
+void DS3231_timestamp_edge(ds3231Timestamp* stamp, uint32_t count)
+{
+	uint32_t delta = count - stamp->edge_count;
+	uint32_t rate = stamp->rate_q4 >> 4;
+	uint32_t tolerance = (uint32_t)(((uint64_t)stamp->nominal_hz *
+			DS3231_TIMESTAMP_TOLERANCE_PPM) / 1000000);
+	uint32_t elapsed = 1;
+	int32_t error;
+
+	stamp->sequence++;
+	__DMB();
+
+	if(stamp->edges){
+		if(delta > stamp->nominal_hz - tolerance &&
+				delta < stamp->nominal_hz + tolerance){
+			error = (int32_t)((delta << 4) - stamp->rate_q4);
+			DS3231_timestamp_set_rate(stamp, stamp->rate_q4 +
+					(error >> DS3231_TIMESTAMP_FILTER_SHIFT));
+		}else if(delta > rate){
+			//missed edges, keep the rate and count the seconds that passed
+			elapsed = (delta + rate / 2) / rate;
+		}
+	}
+
+	stamp->edge_count = count;
+	stamp->seconds += elapsed;
+	if(stamp->edges < 2)
+		stamp->edges++;
+
+	__DMB();
+	stamp->sequence++;
+}
+
+void DS3231_timestamp_set_time(ds3231Timestamp* stamp, ds3231Time* time)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	stamp->sequence++;
+	stamp->seconds = DS3231_time_to_epoch(time);
+	stamp->sequence++;
+	__set_PRIMASK(primask);
+}
+
+uint64_t DS3231_timestamp_now(ds3231Timestamp* stamp)
+{
+	uint32_t sequence, elapsed, seconds, rate_q4, us;
+	uint64_t us_per_tick;
+	uint8_t edges;
+
+	do{
+		while((sequence = stamp->sequence) & 1);
+		__DMB();
+		elapsed = __HAL_TIM_GET_COUNTER(stamp->timer) - stamp->edge_count;
+		seconds = stamp->seconds;
+		rate_q4 = stamp->rate_q4;
+		us_per_tick = stamp->us_per_tick_q32;
+		edges = stamp->edges;
+		__DMB();
+	}while(sequence != stamp->sequence);
+
+	if(edges < 2 || !seconds)
+		return DS3231_TIMESTAMP_INVALID;
+
+	//past the end of the second the edge is late, hold until it arrives
+	if(elapsed >= (rate_q4 >> 4))
+		us = 999999;
+	else{
+		us = (uint32_t)((elapsed * us_per_tick) >> 32);
+		if(us > 999999)
+			us = 999999;
+	}
+
+	return (uint64_t)seconds * 1000000 + us;
+}
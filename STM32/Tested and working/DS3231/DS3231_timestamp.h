@@ -0,0 +1,114 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Microsecond timestamps from the DS3231 1 Hz edge and a free running timer
+ *	
+ * A free running 32 bit timer (eg. TIM2 in timer_config.c) is latched on
+ * every falling edge of the DS3231's 1 Hz square wave. The count between
+ * two edges measures the timer's rate against the RTC, and the count since
+ * the last edge gives the fraction of the current second. A timestamp is
+ * read without any I2C traffic and has the RTC's long term accuracy with
+ * the timer's resolution.
+ *
+ * The SQW pin has to be set to 1 Hz, eg. by DS3231_clock_init. Pass the
+ * counter value latched as close to the edge as possible, an input capture
+ * channel gives the best result, reading the counter in the EXTI handler
+ * adds the interrupt latency as jitter.
+ *
+ * Usage:
+ *	ds3231Timestamp stamp;
+ *	DS3231_timestamp_init(&stamp, &htim2, 84000000);
+ *	DS3231_timestamp_set_time(&stamp, &now);	//time of the current second
+ *
+ *	void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)	//falling edge
+ *	{
+ *		if(GPIO_Pin == SQW_Pin)
+ *			DS3231_timestamp_edge(&stamp, __HAL_TIM_GET_COUNTER(&htim2));
+ *	}
+ *
+ *	uint64_t us = DS3231_timestamp_now(&stamp);
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef DS3231_TIMESTAMP_H_
+#define DS3231_TIMESTAMP_H_
+
+#include "DS3231_stm32_hal.h"
+
+/** Measured rates further than this from the nominal rate are rejected */
+#define DS3231_TIMESTAMP_TOLERANCE_PPM	2000
+
+/** Weight of a new rate measurement, 1/2^n */
+#define DS3231_TIMESTAMP_FILTER_SHIFT	3
+
+#define DS3231_TIMESTAMP_INVALID		0
+
+typedef struct {
+	TIM_HandleTypeDef* timer;	/*!< Free running, counting over the full 32 bits */
+	uint32_t nominal_hz;
+
+	volatile uint32_t sequence;	/*!< Odd while the ISR is updating */
+	volatile uint32_t edge_count;	/*!< Timer count at the last edge */
+	volatile uint32_t seconds;	/*!< Epoch seconds that started at the last edge */
+	volatile uint32_t rate_q4;	/*!< Timer ticks per RTC second, 4 fractional bits */
+	volatile uint64_t us_per_tick_q32;	/*!< 10^6 / rate, 32 fractional bits */
+	volatile uint8_t edges;		/*!< Edges seen, saturates at 2 */
+} ds3231Timestamp;
+
+/**
+ * @brief Initialises the timestamp service
+ *
+ * @param stamp - Timestamp service
+ * @param timer - Free running 32 bit timer
+ * @param timer_hz - Nominal count rate of the timer
+ **/
+void DS3231_timestamp_init(ds3231Timestamp* stamp, TIM_HandleTypeDef* timer,
+		uint32_t timer_hz);
+
+/**
+ * @brief Call on each falling edge of SQW
+ *
+ * @param count - Timer count latched at the edge
+ **/
+void DS3231_timestamp_edge(ds3231Timestamp* stamp, uint32_t count);
+
+/**
+ * @brief Sets the epoch second that started at the last edge
+ *
+ * Call with the time read from the RTC after an edge and before the next
+ * one, eg. from DS3231_clock_get_time.
+ **/
+void DS3231_timestamp_set_time(ds3231Timestamp* stamp, ds3231Time* time);
+
+/**
+ * @brief Returns the current time
+ *
+ * The fraction is clamped below one second so that the value never runs
+ * backwards when an edge arrives late.
+ *
+ * @return Microseconds since 1970-01-01 00:00:00, DS3231_TIMESTAMP_INVALID
+ * until the time is set and the rate has been measured once
+ **/
+uint64_t DS3231_timestamp_now(ds3231Timestamp* stamp);
+
+#endif /* DS3231_TIMESTAMP_H_ */
@@ -0,0 +1,143 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Host simulation of DS3231 drift calibration convergence
+ *	
+ * Runs DS3231_calibration against a simulated RTC with a set frequency
+ * error, a daily temperature wobble and reference jitter, over two days
+ * with samples every second and every minute. The aging offset written to
+ * the register model changes the simulated rate the way the chip does,
+ * 0.1 ppm per LSB. Every correction is printed with the fit a double
+ * precision least-squares line gives over the same window. Returns non
+ * zero if the error left at the end is above 0.15 ppm.
+ *
+ * Build and run from the DS3231 directory:
+ *	gcc -O2 -Ihost -I. -I../../../Common host/ds3231_calibration_sim.c \
+ *		DS3231_calibration.c host/ds3231_host.c -lm -o calibration_sim
+ *	./calibration_sim
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "DS3231_calibration.h"
+#include "ds3231_host.h"
+
+#define SIM_DAYS		2
+#define WINDOW_S		(6 * 3600)
+#define WOBBLE_PPM		0.05	//daily temperature swing of the crystal
+#define JITTER_US		2		//reference timestamp noise, +-
+#define MAX_ERROR_PPM	0.15
+
+static ds3231_host_t chip;
+static double true_ppm;
+
+//double precision fit of the same window for comparison
+static double sx, sy, sxx, sxy;
+static uint32_t sn;
+
+static double rtc_ppm(void)
+{
+	return true_ppm - 0.1 * (int8_t)chip.reg[DS3231_AGING];
+}
+
+static void log_step(void* context, const ds3231CalibrationStep* step)
+{
+	double fit = (sn * sxy - sx * sy) / (sn * sxx - sx * sx);
+
+	(void)context;
+	printf("  step %2u: %6u samples over %5u s, fitted %+7.3f ppm "
+			"(double %+7.3f), offset %+4d -> %+4d, now %+6.3f ppm\n",
+			step->step, step->samples, step->window_s, step->error_ppb / 1000.0,
+			fit, step->old_offset, step->new_offset, rtc_ppm());
+	sx = sy = sxx = sxy = 0;
+	sn = 0;
+}
+
+static int run(double ppm, uint32_t interval_s)
+{
+	I2C_HandleTypeDef hi2c;
+	ds3231Calibration cal;
+	double reference = 1e12, first = 0, x, y;
+	uint32_t sec, rtc = 1700000000u, first_rtc = 0;
+	uint64_t sample;
+	double error;
+
+	true_ppm = ppm;
+	ds3231_host_init(&chip, 200);
+	ds3231_host_attach(&chip, &hi2c);
+	sx = sy = sxx = sxy = 0;
+	sn = 0;
+	srand(1);
+
+	printf("true error %+.1f ppm (%+.1f s/week), sample every %u s\n", ppm,
+			ppm * 0.6048, interval_s);
+
+	if(DS3231_calibration_init(&cal, &hi2c, WINDOW_S, log_step, NULL) != HAL_OK)
+		return 1;
+
+	for(sec = 0; sec < SIM_DAYS * 86400; sec += interval_s){
+		//a fast RTC finishes its seconds early against the reference
+		reference += interval_s * 1e6 / (1 + (rtc_ppm() +
+				WOBBLE_PPM * sin(sec / 86400.0 * 2 * M_PI)) * 1e-6);
+		rtc += interval_s;
+		sample = (uint64_t)(reference + (rand() % (2 * JITTER_US + 1)) -
+				JITTER_US);
+
+		if(!sn){
+			first = sample;
+			first_rtc = rtc;
+		}
+		x = rtc - first_rtc;
+		y = x * 1e6 - (sample - first);
+		sx += x;
+		sy += y;
+		sxx += x * x;
+		sxy += x * y;
+		sn++;
+
+		DS3231_calibration_sample(&cal, sample, rtc);
+	}
+
+	error = fabs(rtc_ppm());
+	printf("  remaining error %.3f ppm\n", error);
+
+	return error > MAX_ERROR_PPM;
+}
+
+int main(void)
+{
+	const double ppm[] = {8.3, -4.7, 12.1};
+	const uint32_t interval[] = {60, 1};
+	int failed = 0;
+	uint8_t i, j;
+
+	for(j = 0; j < sizeof(interval) / sizeof(interval[0]); j++)
+		for(i = 0; i < sizeof(ppm) / sizeof(ppm[0]); i++)
+			failed |= run(ppm[i], interval[j]);
+
+	printf(failed ? "FAILED\n" : "passed\n");
+	return failed;
+}
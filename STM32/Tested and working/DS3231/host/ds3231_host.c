@@ -0,0 +1,224 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Register file model of the DS3231 for host builds
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <string.h>
+
+#include "ds3231_host.h"
+
+//control and status bits the model acts on
+#define HOST_CONV	5
+#define HOST_BSY	2
+#define HOST_CONTROL	0x0E
+#define HOST_STATUS		0x0F
+
+static uint32_t host_tick = 0;
+
+void HAL_Delay(uint32_t Delay)
+{
+	host_tick += Delay;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return host_tick;
+}
+
+//the HAL declares its completion callbacks weak, so do the same here
+__attribute__((weak)) void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	(void)hi2c;
+}
+
+__attribute__((weak)) void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	(void)hi2c;
+}
+
+void ds3231_host_init(ds3231_host_t* chip, uint32_t conversion_ms)
+{
+	memset(chip, 0, sizeof(*chip));
+	chip->conversion_ms = conversion_ms;
+	//INTCN set, oscillator stop flag set as after first power up
+	chip->reg[HOST_CONTROL] = 0x1C;
+	chip->reg[HOST_STATUS] = 0x88;
+}
+
+void ds3231_host_attach(ds3231_host_t* chip, I2C_HandleTypeDef* hi2c)
+{
+	hi2c->chip = chip;
+}
+
+static void ds3231_host_read(ds3231_host_t* chip, uint8_t address,
+		uint8_t* data, uint16_t size)
+{
+	uint16_t i;
+
+	chip->reads++;
+	//the address pointer wraps from the last register back to 0
+	for(i = 0; i < size; i++)
+		data[i] = chip->reg[(address + i) % DS3231_HOST_REGISTERS];
+}
+
+static void ds3231_host_write(ds3231_host_t* chip, uint8_t address,
+		const uint8_t* data, uint16_t size)
+{
+	uint8_t reg;
+	uint16_t i;
+
+	chip->writes++;
+	for(i = 0; i < size; i++){
+		reg = (address + i) % DS3231_HOST_REGISTERS;
+		if(reg == HOST_CONTROL && (data[i] & (1 << HOST_CONV)) &&
+				!chip->converting){
+			chip->converting = 1;
+			chip->conversion_end = host_tick + chip->conversion_ms;
+			chip->reg[HOST_STATUS] |= (1 << HOST_BSY);
+		}
+		//BSY is read only, OSF and the alarm flags can only be cleared
+		if(reg == HOST_STATUS)
+			chip->reg[reg] = (chip->reg[reg] & (1 << HOST_BSY)) |
+					(data[i] & 0x08) | (chip->reg[reg] & data[i] & 0x83);
+		else if(reg == HOST_CONTROL && chip->converting)
+			chip->reg[reg] = data[i] | (1 << HOST_CONV);
+		else if(reg < 0x11)
+			chip->reg[reg] = data[i];
+	}
+}
+
+static ds3231_host_t* ds3231_host_chip(I2C_HandleTypeDef* hi2c)
+{
+	return hi2c ? (ds3231_host_t*)hi2c->chip : NULL;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c,
+		uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize,
+		uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	ds3231_host_t* chip = ds3231_host_chip(hi2c);
+
+	(void)DevAddress;
+	(void)MemAddSize;
+	(void)Timeout;
+
+	if(chip == NULL)
+		return HAL_ERROR;
+	if(chip->pending_port)
+		return HAL_BUSY;
+
+	ds3231_host_write(chip, MemAddress, pData, Size);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c,
+		uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize,
+		uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	ds3231_host_t* chip = ds3231_host_chip(hi2c);
+
+	(void)DevAddress;
+	(void)MemAddSize;
+	(void)Timeout;
+
+	if(chip == NULL)
+		return HAL_ERROR;
+	if(chip->pending_port)
+		return HAL_BUSY;
+
+	ds3231_host_read(chip, MemAddress, pData, Size);
+	return HAL_OK;
+}
+
+static HAL_StatusTypeDef ds3231_host_queue(I2C_HandleTypeDef *hi2c,
+		uint8_t read, uint16_t MemAddress, uint8_t *pData, uint16_t Size)
+{
+	ds3231_host_t* chip = ds3231_host_chip(hi2c);
+
+	if(chip == NULL)
+		return HAL_ERROR;
+	if(chip->pending_port)
+		return HAL_BUSY;
+
+	chip->pending_port = hi2c;
+	chip->pending_read = read;
+	chip->pending_address = MemAddress;
+	chip->pending_data = pData;
+	chip->pending_size = Size;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *hi2c,
+		uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize,
+		uint8_t *pData, uint16_t Size)
+{
+	(void)DevAddress;
+	(void)MemAddSize;
+
+	return ds3231_host_queue(hi2c, 0, MemAddress, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c,
+		uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize,
+		uint8_t *pData, uint16_t Size)
+{
+	(void)DevAddress;
+	(void)MemAddSize;
+
+	return ds3231_host_queue(hi2c, 1, MemAddress, pData, Size);
+}
+
+uint8_t ds3231_host_complete(ds3231_host_t* chip)
+{
+	I2C_HandleTypeDef* port = chip->pending_port;
+
+	if(port == NULL)
+		return 0;
+
+	//the data moves when the transfer ends, as with a real interrupt transfer
+	chip->pending_port = NULL;
+	if(chip->pending_read){
+		ds3231_host_read(chip, chip->pending_address, chip->pending_data,
+				chip->pending_size);
+		HAL_I2C_MemRxCpltCallback(port);
+	}else{
+		ds3231_host_write(chip, chip->pending_address, chip->pending_data,
+				chip->pending_size);
+		HAL_I2C_MemTxCpltCallback(port);
+	}
+
+	return 1;
+}
+
+void ds3231_host_advance(ds3231_host_t* chip, uint32_t ms)
+{
+	host_tick += ms;
+
+	if(chip->converting && (int32_t)(host_tick - chip->conversion_end) >= 0){
+		chip->converting = 0;
+		chip->reg[HOST_CONTROL] &= ~(1 << HOST_CONV);
+		chip->reg[HOST_STATUS] &= ~(1 << HOST_BSY);
+	}
+}
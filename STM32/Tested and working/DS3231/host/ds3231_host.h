@@ -0,0 +1,86 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Register file model of the DS3231 for host builds
+ *	
+ * The model holds the 19 registers and the address pointer. Blocking
+ * HAL transfers complete at once, interrupt transfers complete when
+ * ds3231_host_complete is called so that tests choose when the callback
+ * runs. A running temperature conversion holds CONV and BSY for a set
+ * number of ticks.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef DS3231_HOST_H_
+#define DS3231_HOST_H_
+
+#include <stdint.h>
+
+#include "stm32f4xx_hal.h"
+
+#define DS3231_HOST_REGISTERS	19
+
+typedef struct ds3231_host ds3231_host_t;
+struct ds3231_host{
+	uint8_t reg[DS3231_HOST_REGISTERS];
+
+	uint32_t conversion_ms;		/*!< Time CONV and BSY stay set after CONV is written */
+	uint32_t conversion_end;	/*!< Tick the running conversion finishes at */
+	uint8_t converting;
+
+	//interrupt transfer waiting for ds3231_host_complete
+	I2C_HandleTypeDef* pending_port;
+	uint8_t pending_read;
+	uint8_t pending_address;
+	uint8_t* pending_data;
+	uint16_t pending_size;
+
+	uint32_t reads;				/*!< Register reads, blocking and interrupt */
+	uint32_t writes;			/*!< Register writes, blocking and interrupt */
+};
+
+/**
+ * @brief Clears the registers to their power on state
+ *
+ * @param conversion_ms - Length of a temperature conversion
+ **/
+void ds3231_host_init(ds3231_host_t* chip, uint32_t conversion_ms);
+
+/**
+ * @brief Routes HAL I2C transfers made on the given handle to the model
+ **/
+void ds3231_host_attach(ds3231_host_t* chip, I2C_HandleTypeDef* hi2c);
+
+/**
+ * @brief Finishes the pending interrupt transfer and runs its callback
+ *
+ * @return 1 if a transfer was pending
+ **/
+uint8_t ds3231_host_complete(ds3231_host_t* chip);
+
+/**
+ * @brief Moves HAL_GetTick on and ends conversions that are due
+ **/
+void ds3231_host_advance(ds3231_host_t* chip, uint32_t ms);
+
+#endif /* DS3231_HOST_H_ */
@@ -0,0 +1,152 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Host test of the DS3231 hybrid timestamps against a drifting timer
+ *	
+ * Feeds DS3231_timestamp_edge with SQW edges from a simulated timer that
+ * runs off by a set number of ppm, with interrupt latency jitter and two
+ * missed edges, and compares DS3231_timestamp_now against the true time
+ * 50 times a second. Also checks DS3231_time_to_epoch against gmtime in
+ * 24 and 12 hour mode. Returns non zero on failure.
+ *
+ * Build and run from the DS3231 directory:
+ *	gcc -O2 -Ihost -I. -I../../../Common \
+ *		host/ds3231_timestamp_test.c DS3231_timestamp.c DS3231_stm32_hal.c \
+ *		../../../Common/rtc_codec.c host/ds3231_host.c -o timestamp_test
+ *	./timestamp_test
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "DS3231_timestamp.h"
+
+#define TIMER_HZ		84000000
+#define TEST_SECONDS	600
+#define SETTLE_SECONDS	30
+#define READS_PER_SECOND	50
+#define JITTER_TICKS	40		//ISR latency before the counter is latched
+#define MAX_ERROR_US	3
+
+static uint32_t check_epoch(void)
+{
+	uint32_t bad = 0;
+	time_t t;
+	struct tm* g;
+	ds3231Time d = {0};
+
+	for(t = 0; t < 4102444800LL; t += 3607 * 13){
+		g = gmtime(&t);
+		d.year = g->tm_year + 1900;
+		d.month = g->tm_mon + 1;
+		d.date = g->tm_mday;
+		d.hour = g->tm_hour;
+		d.min = g->tm_min;
+		d.sec = g->tm_sec;
+		d.twelve_hour = 0;
+		d.pm = 0;
+		if(DS3231_time_to_epoch(&d) != (uint32_t)t)
+			bad++;
+
+		d.twelve_hour = 1;
+		d.pm = g->tm_hour >= 12;
+		d.hour = g->tm_hour % 12 ? g->tm_hour % 12 : 12;
+		if(DS3231_time_to_epoch(&d) != (uint32_t)t)
+			bad++;
+	}
+
+	return bad;
+}
+
+static int run(double ppm)
+{
+	TIM_TypeDef tim = {0};
+	TIM_HandleTypeDef htim = {&tim};
+	ds3231Timestamp stamp;
+	ds3231Time d = {0};
+	double hz = TIMER_HZ * (1 + ppm * 1e-6);
+	double t, truth, error, max_error = 0, sum = 0;
+	uint64_t now, last = 0;
+	uint32_t base, samples = 0, backwards = 0;
+	int sec, k;
+
+	DS3231_timestamp_init(&stamp, &htim, TIMER_HZ);
+	d.year = 2024;
+	d.month = 6;
+	d.date = 1;
+	base = DS3231_time_to_epoch(&d);
+	srand(1);
+
+	for(sec = 0; sec < TEST_SECONDS; sec++){
+		//two edges lost, the service has to count the seconds they covered
+		if(sec != 300 && sec != 301)
+			DS3231_timestamp_edge(&stamp,
+					(uint32_t)(long long)(sec * hz) + rand() % JITTER_TICKS);
+		if(sec == 0)
+			DS3231_timestamp_set_time(&stamp, &d);
+
+		for(k = 0; k < READS_PER_SECOND; k++){
+			t = sec + (k + 0.5) / READS_PER_SECOND;
+			tim.CNT = (uint32_t)(long long)(t * hz);
+			now = DS3231_timestamp_now(&stamp);
+			if(now == DS3231_TIMESTAMP_INVALID)
+				continue;
+			if(now < last)
+				backwards++;
+			last = now;
+
+			if(sec < SETTLE_SECONDS || sec == 300 || sec == 301)
+				continue;
+			truth = (base + t) * 1e6;
+			error = now > truth ? now - truth : truth - now;
+			if(error > max_error)
+				max_error = error;
+			sum += error;
+			samples++;
+		}
+	}
+
+	printf("timer %+5.0f ppm: max error %.1f us, mean %.2f us, %u samples, "
+			"%u backwards\n", ppm, max_error, sum / samples, samples,
+			backwards);
+
+	return max_error > MAX_ERROR_US || backwards;
+}
+
+int main(void)
+{
+	const double ppm[] = {-100, -20, 0, 35, 150};
+	uint32_t bad = check_epoch();
+	int failed = bad != 0;
+	uint8_t i;
+
+	printf("epoch mismatches %u\n", bad);
+
+	for(i = 0; i < sizeof(ppm) / sizeof(ppm[0]); i++)
+		failed |= run(ppm[i]);
+
+	printf(failed ? "FAILED\n" : "passed\n");
+	return failed;
+}
@@ -0,0 +1,89 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Minimal STM32 HAL replacement for building the DS3231 library
+ *          on a host machine
+ *	
+ * Put this directory in front of the real HAL on the include path. I2C
+ * register reads and writes then go to the register file model in
+ * ds3231_host.c and the timer counter is a plain variable.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef DS3231_HOST_HAL_H_
+#define DS3231_HOST_HAL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define __IO volatile
+
+typedef enum
+{
+	HAL_OK       = 0x00U,
+	HAL_ERROR    = 0x01U,
+	HAL_BUSY     = 0x02U,
+	HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+/** Stands in for the I2C peripheral, points at the attached model */
+typedef struct {
+	void* chip;
+} I2C_HandleTypeDef;
+
+typedef struct {
+	__IO uint32_t CNT;
+} TIM_TypeDef;
+
+typedef struct {
+	TIM_TypeDef* Instance;
+} TIM_HandleTypeDef;
+
+#define __HAL_TIM_GET_COUNTER(h)	((h)->Instance->CNT)
+
+static inline uint32_t __get_PRIMASK(void){ return 0; }
+static inline void __set_PRIMASK(uint32_t primask){ (void)primask; }
+static inline void __disable_irq(void){}
+static inline void __enable_irq(void){}
+static inline void __DMB(void){}
+
+void HAL_Delay(uint32_t Delay);
+uint32_t HAL_GetTick(void);
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c,
+		uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize,
+		uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c,
+		uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize,
+		uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *hi2c,
+		uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize,
+		uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c,
+		uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize,
+		uint8_t *pData, uint16_t Size);
+
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c);
+
+#endif /* DS3231_HOST_HAL_H_ */
@@ -29,7 +29,6 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "stm32f1xx_hal.h"
 #include "SN54HC595.h"
 
 void SN54HC595_init(void)
@@ -118,22 +117,35 @@ void SN54HC595_reset_latch(void)
 	HAL_GPIO_WritePin(LATCH_PORT, LATCH_PIN, GPIO_PIN_RESET);
 }
 
+//returns bit j of the shift order of byte
+static inline uint8_t SN54HC595_bit(uint8_t byte, uint8_t j, uint8_t bit_order)
+{
+	if(bit_order == SN54HC595_LSB_FIRST)
+		return (byte >> j) & 0x01;
+
+	return (byte >> (7 - j)) & 0x01;
+}
+
+static void SN54HC595_shift_byte(uint8_t byte)
+{
+	for(uint8_t j = 0; j < 8; j++){
+		if(SN54HC595_bit(byte, j, SN54HC595_BIT_ORDER))
+			HAL_GPIO_WritePin(SER_IN_PORT, SER_IN_PIN, GPIO_PIN_SET);
+		else
+			HAL_GPIO_WritePin(SER_IN_PORT, SER_IN_PIN, GPIO_PIN_RESET);
+		//clock bit
+		SN54HC595_clock_register();
+	}
+}
+
 void SN54HC595_out_bytes(uint8_t* data, uint8_t byte_count)
 {
 	//Set serial clock and latch pin low
 	HAL_GPIO_WritePin(SER_CLK_PORT, SER_CLK_PIN, GPIO_PIN_RESET);
-	for(uint8_t i = 0; i < byte_count; i++){
-		for(uint8_t j = 0; j < 8; j++){
-			if(*(data + (i * sizeof(uint8_t))) & (1 << j))
-				HAL_GPIO_WritePin(SER_IN_PORT, SER_IN_PIN, GPIO_PIN_SET);
-			else
-				HAL_GPIO_WritePin(SER_IN_PORT, SER_IN_PIN, GPIO_PIN_RESET);
-			//clock bit
-			SN54HC595_clock_register();
-		}
-		//latch data
-		SN54HC595_latch_register();
-	}
+	for(uint8_t i = 0; i < byte_count; i++)
+		SN54HC595_shift_byte(data[i]);
+	//latch data
+	SN54HC595_latch_register();
 }
 
 void SN54HC595_out_bytes_w_delay(uint8_t* data, uint8_t byte_count, uint32_t delay)
@@ -141,14 +153,7 @@ void SN54HC595_out_bytes_w_delay(uint8_t* data, uint8_t byte_count, uint32_t del
 	//Set serial clock and latch pin low
 	HAL_GPIO_WritePin(SER_CLK_PORT, SER_CLK_PIN, GPIO_PIN_RESET);
 	for(uint8_t i = 0; i < byte_count; i++){
-		for(uint8_t j = 0; j < 8; j++){
-			if(*(data + (i * sizeof(uint8_t))) & (1 << j))
-				HAL_GPIO_WritePin(SER_IN_PORT, SER_IN_PIN, GPIO_PIN_SET);
-			else
-				HAL_GPIO_WritePin(SER_IN_PORT, SER_IN_PIN, GPIO_PIN_RESET);
-			//clock bit
-			SN54HC595_clock_register();
-		}
+		SN54HC595_shift_byte(data[i]);
 		//latch data
 		SN54HC595_latch_register();
 		HAL_Delay(delay);
@@ -157,22 +162,26 @@ void SN54HC595_out_bytes_w_delay(uint8_t* data, uint8_t byte_count, uint32_t del
 
 #ifdef USE_SN54HC595_STRUCTS
 
+static void shift_byte_self(shift_array_t* self, uint8_t byte)
+{
+	for(uint8_t j = 0; j < 8; j++){
+		if(SN54HC595_bit(byte, j, self->bit_order))
+			HAL_GPIO_WritePin(self->ser_in_port, self->ser_in_pin, GPIO_PIN_SET);
+		else
+			HAL_GPIO_WritePin(self->ser_in_port, self->ser_in_pin, GPIO_PIN_RESET);
+		//clock bit
+		self->clock_data(self);
+	}
+}
+
 void output_self(shift_array_t* self, uint8_t byte_count)
 {
 	//Set serial clock and latch pin low
 	HAL_GPIO_WritePin(self->ser_clk_port, self->ser_clk_pin, GPIO_PIN_RESET);
-	for(uint8_t i = 0; i < byte_count; i++){
-		for(uint8_t j = 0; j < 8; j++){
-			if(*(self->out_buf + (i * sizeof(uint8_t))) & (1 << (7 - j)))
-				HAL_GPIO_WritePin(self->ser_in_port, self->ser_in_pin, GPIO_PIN_SET);
-			else
-				HAL_GPIO_WritePin(self->ser_in_port, self->ser_in_pin, GPIO_PIN_RESET);
-			//clock bit
-			self->clock_data(self);
-		}
+	for(uint8_t i = 0; i < byte_count; i++)
+		shift_byte_self(self, self->out_buf[i]);
 	//latch data
 	self->latch(self);
-	}
 }
 
 void output_self_delay(shift_array_t* self, uint8_t byte_count, uint32_t delay)
@@ -180,17 +189,10 @@ void output_self_delay(shift_array_t* self, uint8_t byte_count, uint32_t delay)
 	//Set serial clock and latch pin low
 	HAL_GPIO_WritePin(self->ser_clk_port, self->ser_clk_pin, GPIO_PIN_RESET);
 	for(uint8_t i = 0; i < byte_count; i++){
-		for(uint8_t j = 0; j < 8; j++){
-			if(*(self->out_buf + (i * sizeof(uint8_t))) & (1 << j))
-				HAL_GPIO_WritePin(self->ser_in_port, self->ser_in_pin, GPIO_PIN_SET);
-			else
-				HAL_GPIO_WritePin(self->ser_in_port, self->ser_in_pin, GPIO_PIN_RESET);
-			//clock bit
-			self->clock_data(self);
-		}
-	//latch data
-	self->latch(self);
-	HAL_Delay(delay);
+		shift_byte_self(self, self->out_buf[i]);
+		//latch data
+		self->latch(self);
+		HAL_Delay(delay);
 	}
 }
 
@@ -226,12 +228,75 @@ void set_data_self(shift_array_t* self, uint8_t* data)
 	memcpy(self->out_buf, data, self->dev_count);
 }
 
+uint8_t* SN54HC595_frame_back(shift_array_t* self)
+{
+	return self->back_buf;
+}
+
+uint8_t SN54HC595_frame_commit(shift_array_t* self)
+{
+	uint32_t primask;
+	uint8_t* front;
+
+#ifdef USE_SN54HC595_SPI
+	//the old front is about to become the back buffer
+	if(self->spi != NULL && SN54HC595_spi_flush(self) != HAL_OK)
+		return 0;
+#endif
+
+	if(self->frame_shown &&
+			memcmp(self->back_buf, self->out_buf, self->dev_count) == 0)
+		return 0;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	front = self->back_buf;
+	self->back_buf = self->out_buf;
+	self->out_buf = front;
+	__set_PRIMASK(primask);
+
+	self->output(self, self->dev_count);
+	self->frame_shown = 1;
+
+	//start the next frame from this one
+	memcpy(self->back_buf, self->out_buf, self->dev_count);
+
+	return 1;
+}
+
 void clock_data_self(shift_array_t* self)
 {
 	HAL_GPIO_WritePin(self->ser_clk_port, self->ser_clk_pin, GPIO_PIN_SET);
 	HAL_GPIO_WritePin(self->ser_clk_port, self->ser_clk_pin, GPIO_PIN_RESET);
 }
 
+//latch, output enable and clear, shared by the GPIO and SPI outputs
+static void init_control_pins(shift_array_t* self)
+{
+	GPIO_InitTypeDef GPIO_InitStruct;
+
+	/*Configure latch pin */
+	GPIO_InitStruct.Pin = self->latch_pin;
+	GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+	GPIO_InitStruct.Pull = GPIO_NOPULL;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+	HAL_GPIO_Init(self->latch_port, &GPIO_InitStruct);
+
+	/*Configure output enable */
+	GPIO_InitStruct.Pin = self->out_ena_pin;
+	GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+	GPIO_InitStruct.Pull = GPIO_NOPULL;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+	HAL_GPIO_Init(self->out_ena_port, &GPIO_InitStruct);
+
+	/*Configure serial clear */
+	GPIO_InitStruct.Pin = self->sr_clr_pin;
+	GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+	GPIO_InitStruct.Pull = GPIO_NOPULL;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+	HAL_GPIO_Init(self->sr_clr_port, &GPIO_InitStruct);
+}
+
 void SN54HC595_init_obj(shift_array_t* self)
 {
 	//CLOCK ENABLE STUFF
@@ -263,32 +328,21 @@ void SN54HC595_init_obj(shift_array_t* self)
 	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
 	HAL_GPIO_Init(self->ser_clk_port, &GPIO_InitStruct);
 
-	/*Configure latch pin */
-	GPIO_InitStruct.Pin = self->latch_pin;
-	GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
-	GPIO_InitStruct.Pull = GPIO_NOPULL;
-	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
-	HAL_GPIO_Init(self->latch_port, &GPIO_InitStruct);
-
-	/*Configure output enable */
-	GPIO_InitStruct.Pin = self->out_ena_pin;
-	GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
-	GPIO_InitStruct.Pull = GPIO_NOPULL;
-	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
-	HAL_GPIO_Init(self->out_ena_port, &GPIO_InitStruct);
-
-	/*Configure serial clear */
-	GPIO_InitStruct.Pin = self->sr_clr_pin;
-	GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
-	GPIO_InitStruct.Pull = GPIO_NOPULL;
-	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
-	HAL_GPIO_Init(self->sr_clr_port, &GPIO_InitStruct);
+	init_control_pins(self);
 
 	enable_self(self);
 
 	reset_latch_self(self);
 
 	self->out_buf = (uint8_t*)calloc(1, sizeof(uint8_t)* self->dev_count);
+	self->back_buf = (uint8_t*)calloc(1, sizeof(uint8_t)* self->dev_count);
+	self->frame_shown = 0;
+
+#ifdef USE_SN54HC595_SPI
+	//the frame, mux and BAM code take a NULL spi as the GPIO backend
+	self->spi = NULL;
+	self->busy = 0;
+#endif
 
 	self->output = &output_self;
 	self->output_delay = &output_self_delay;
@@ -301,4 +355,91 @@ void SN54HC595_init_obj(shift_array_t* self)
 	self->clock_data = &clock_data_self;
 }
 
+#ifdef USE_SN54HC595_SPI
+
+HAL_StatusTypeDef SN54HC595_spi_flush(shift_array_t* self)
+{
+	uint32_t start = HAL_GetTick();
+
+	while(self->busy)
+		if(HAL_GetTick() - start > SN54HC595_SPI_TIMEOUT){
+			//drop the transfer rather than latch half a frame
+			HAL_SPI_DMAStop(self->spi);
+			self->busy = 0;
+			return HAL_TIMEOUT;
+		}
+
+	return HAL_OK;
+}
+
+void output_spi_self(shift_array_t* self, uint8_t byte_count)
+{
+	if(SN54HC595_spi_flush(self) != HAL_OK)
+		return;
+
+	self->busy = 1;
+	if(HAL_SPI_Transmit_DMA(self->spi, self->out_buf, byte_count) != HAL_OK)
+		self->busy = 0;
+}
+
+void output_spi_self_delay(shift_array_t* self, uint8_t byte_count, uint32_t delay)
+{
+	if(SN54HC595_spi_flush(self) != HAL_OK)
+		return;
+
+	for(uint8_t i = 0; i < byte_count; i++){
+		HAL_SPI_Transmit(self->spi, &self->out_buf[i], 1, SN54HC595_SPI_TIMEOUT);
+		//latch data
+		self->latch(self);
+		HAL_Delay(delay);
+	}
+}
+
+void SN54HC595_spi_tx_complete(shift_array_t* self)
+{
+	self->latch(self);
+	self->busy = 0;
+}
+
+int8_t SN54HC595_init_spi(shift_array_t* self)
+{
+	//the SPI shifts the bits, bit_order is not applied by the output
+	if(self->spi->Init.FirstBit != (self->bit_order == SN54HC595_LSB_FIRST ?
+			SPI_FIRSTBIT_LSB : SPI_FIRSTBIT_MSB))
+		return -1;
+
+	//CLOCK ENABLE STUFF
+	if(self->latch_clock_init)
+		CLOCK_SWITCH(self->latch_port);
+	if(self->out_ena_connected && self->out_ena_clock_init)
+		CLOCK_SWITCH(self->out_ena_port);
+	if(self->sr_clr_connected && self->sr_clr_clock_init)
+		CLOCK_SWITCH(self->sr_clr_port);
+
+	init_control_pins(self);
+
+	enable_self(self);
+
+	reset_latch_self(self);
+
+	self->busy = 0;
+	self->out_buf = (uint8_t*)calloc(1, sizeof(uint8_t)* self->dev_count);
+	self->back_buf = (uint8_t*)calloc(1, sizeof(uint8_t)* self->dev_count);
+	self->frame_shown = 0;
+
+	self->output = &output_spi_self;
+	self->output_delay = &output_spi_self_delay;
+	self->disbale = &disable_self;
+	self->enable = &enable_self;
+	self->latch = &latch_self;	
+	self->reset_latch = &reset_latch_self;
+	self->set_byte = &set_byte_self;
+	self->set_data = &set_data_self;
+	self->clock_data = &clock_data_self;
+
+	return 0;
+}
+
+#endif
+
 #endif
@@ -81,6 +81,10 @@
 #ifndef SN54HC595_H_
 #define SN54HC595_H_
 
+#include <stdint.h>
+
+#include "stm32f4xx_hal.h"
+
 /** @brief Pleb hack to allow for easy enabling of a GPIO clock*/
 #define CLOCK_SWITCH(PORT)		{if(PORT == GPIOA)\
 							__HAL_RCC_GPIOA_CLK_ENABLE();\
@@ -135,7 +139,7 @@
 * @ingroup Serial_Clock
 * @brief Serial clock GPIO port
 */
-#define SER_CLK_PORT			NULL
+#define SER_CLK_PORT			GPIOG
 /**
 * @ingroup Serial_Clock
 * @brief Serial clock GPIO clock
@@ -206,7 +210,7 @@
 * @ingroup sr_clear
 * @brief Register clear GPIO port
 */
-#define SR_CLR_PORT				NULL
+#define SR_CLR_PORT				GPIOG
 /**
 * @ingroup sr_clear
 * @brief Regiter clear GPIO clock
@@ -223,6 +227,39 @@
 */
 #define USE_SN54HC595_STRUCTS		1
 
+/**
+* @brief Flag to clock shift arrays out over hardware SPI
+*
+* Define to add the SPI and DMA output for shift array objects, see
+* SN54HC595_init_spi. Needs the HAL SPI module, so it is off by default.
+*/
+//#define USE_SN54HC595_SPI			1
+
+/**
+* @brief Time in ms to wait for an SPI transfer in flight
+*/
+#define SN54HC595_SPI_TIMEOUT		100
+
+/**
+* @defgroup bit_order Bit order
+* @brief Which end of each byte is shifted out first
+*
+* With MSB first bit 7 of a byte ends up on output 7 (QH) and bit 0 on
+* output 0 (QA).
+*/
+/** @ingroup bit_order */
+#define SN54HC595_MSB_FIRST		0
+/** @ingroup bit_order */
+#define SN54HC595_LSB_FIRST		1
+
+#ifndef SN54HC595_BIT_ORDER
+/**
+* @ingroup bit_order
+* @brief Bit order used by SN54HC595_out_bytes and SN54HC595_out_bytes_fast
+*/
+#define SN54HC595_BIT_ORDER		SN54HC595_MSB_FIRST
+#endif
+
 #ifdef USE_SN54HC595_STRUCTS
 /**
 * @typedef shift_array_t
@@ -242,6 +279,10 @@ struct shift_array{
 
 	uint8_t dev_count;		/**< Device count*/
 
+	uint8_t* back_buf;		/**< Frame being drawn, see SN54HC595_frame_commit*/
+	uint8_t frame_shown;	/**< out_buf has been shifted out since the last commit*/
+	uint8_t bit_order;		/**< SN54HC595_MSB_FIRST (default) or SN54HC595_LSB_FIRST*/
+
 	/** @defgroup GPIO_struct_pint GPIO refereces */
 	uint16_t ser_in_pin;
 	GPIO_TypeDef* ser_in_port;
@@ -264,6 +305,12 @@ struct shift_array{
 	uint8_t sr_clr_clock_init;
 	uint8_t sr_clr_connected;
 
+#ifdef USE_SN54HC595_SPI
+	/** @defgroup SPI_struct SPI output */
+	SPI_HandleTypeDef* spi;	/**< SPI bus wired to SER and SRCLK*/
+	volatile uint8_t busy;	/**< DMA transfer in flight, latched when it ends*/
+#endif
+
 	/** @defgroup function_pointers Shift array functions */
 	/**
 	* @ingroup function_pointers
@@ -393,8 +440,8 @@ void SN54HC595_reset_latch(void);
 /**
 * @brief Outputs a number of bytes to the SR outputs
 *
-* Clocks the inputted bytes into the shift register and latches
-* the data into the outputs
+* Clocks the inputted bytes into the shift register in
+* SN54HC595_BIT_ORDER and latches the data into the outputs once
 *
 * @param data The byte array to be outputted to the SR
 * @param byte_count The number of bytes to be outputted
@@ -422,7 +469,8 @@ void SN54HC595_out_bytes_w_delay(uint8_t* data, uint8_t byte_count,
 * @brief Causes the shift array to output its output buffer
 *
 * All data stored within the shift array's output buffer is
-* clocked to the shift array's outputs
+* clocked to the shift array's outputs and latched once, in the
+* shift array's bit order
 *
 * @param self Pointer to the shift array
 * @param byte_count Number of bytes to be outputted from the 
@@ -539,6 +587,105 @@ void latch_self(shift_array_t* self);
 */
 void SN54HC595_init_obj(shift_array_t* self);
 
+/**
+* @brief Returns the back buffer to draw the next frame into
+*
+* The back buffer holds a copy of the frame last committed, so only the
+* bytes that change need to be written.
+*
+* @param self Pointer to the shift array
+* @return dev_count bytes, byte 0 ends up in the register furthest from
+* the micro
+*/
+uint8_t* SN54HC595_frame_back(shift_array_t* self);
+
+/**
+* @brief Shows the back buffer
+*
+* Swaps the back buffer with out_buf with interrupts masked, then shifts
+* the whole chain out and latches once, so every register changes on the
+* same latch edge. If the frame is the same as the one already shown
+* nothing is shifted. A chain can only be loaded whole, shifting fewer
+* bytes would move the bytes already in the chain along, so skipping
+* unchanged frames is the only partial refresh there is.
+*
+* @param self Pointer to the shift array
+* @return 1 if the frame was shifted out, 0 if it was unchanged
+*/
+uint8_t SN54HC595_frame_commit(shift_array_t* self);
+
+#ifdef USE_SN54HC595_SPI
+
+/**
+* @brief Initialises a shift array clocked by a hardware SPI
+*
+* SER and SRCLK are driven by MOSI and SCK of self->spi, which must be
+* set up by the caller as a transmit only master, 8 bit, CPOL 0 and
+* CPHA 0 (the 595 shifts on the rising clock edge) with a TX DMA stream
+* linked. The SPI shifts the bits, so its FirstBit must match bit_order:
+* SPI_FIRSTBIT_MSB for SN54HC595_MSB_FIRST, SPI_FIRSTBIT_LSB for
+* SN54HC595_LSB_FIRST. Only the latch, output enable and clear pins are
+* set up here. The rest is as SN54HC595_init_obj, but output sends the
+* output buffer as one DMA transfer and returns at once. Call
+* SN54HC595_spi_tx_complete from HAL_SPI_TxCpltCallback to latch it.
+*
+* The first byte of the output buffer ends up in the register furthest
+* from the micro, as with the bit banged output.
+*
+* @param self Pointer to the shift array, spi and the GPIO pins set
+* @return 0 on success, -1 if the SPI's bit order does not match
+* bit_order, nothing is set up then
+*/
+int8_t SN54HC595_init_spi(shift_array_t* self);
+
+/**
+* @brief Starts a DMA transfer of the output buffer
+*
+* Waits for a transfer still in flight first. The output buffer must not
+* be changed until the transfer ends, see SN54HC595_spi_flush.
+*
+* @param self Pointer to the shift array
+* @param byte_count Number of bytes to be outputted from the 
+* output buffer
+* @return void
+*/
+void output_spi_self(shift_array_t* self, uint8_t byte_count);
+
+/**
+* @brief Outputs the output buffer one byte and latch at a time over SPI,
+* with a delay after each latch
+*
+* @param self Pointer to the shift array
+* @param byte_count Number of bytes to be outputted from the 
+* output buffer
+* @param delay The delay to follow each latch
+* @return void
+*/
+void output_spi_self_delay(shift_array_t* self, uint8_t byte_count, 
+	uint32_t delay);
+
+/**
+* @brief Latches the transferred data, call from HAL_SPI_TxCpltCallback
+*
+* The HAL only calls back once the SPI is no longer busy, so the last bit
+* is in the registers when the latch is pulsed.
+*
+* @param self Pointer to the shift array
+* @return void
+*/
+void SN54HC595_spi_tx_complete(shift_array_t* self);
+
+/**
+* @brief Waits for a transfer in flight to be latched
+*
+* @param self Pointer to the shift array
+* @return HAL_TIMEOUT if the transfer did not end within 
+* SN54HC595_SPI_TIMEOUT, the transfer is then aborted
+*/
+HAL_StatusTypeDef SN54HC595_spi_flush(shift_array_t* self);
+
+#endif
+
 #endif
 
 #endif /* SN54HC595_H_ */
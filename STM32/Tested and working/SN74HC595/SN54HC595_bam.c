@@ -0,0 +1,132 @@
+/**
+ * @file SN54HC595_bam.c
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @copyright GNU GPL v3
+ * @brief   Bit angle modulation dimming for SN54HC595 shift registers
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <string.h>
+
+#include "SN54HC595_bam.h"
+#include "SN54HC595_transpose.h"
+
+#ifdef USE_SN54HC595_STRUCTS
+
+void SN54HC595_bam_build_planes(const uint8_t* levels, uint8_t* planes,
+	uint8_t bytes, uint8_t stride)
+{
+	uint8_t rows[8], columns[8];
+
+	for(uint8_t byte = 0; byte < bytes; byte++){
+		//row 7 - bit holds the level of the output on that bit
+		for(uint8_t bit = 0; bit < 8; bit++)
+			rows[7 - bit] = levels[byte * 8 + bit];
+
+		SN54HC595_transpose8(rows, columns);
+
+		//column 7 - plane holds brightness bit plane of every row
+		for(uint8_t plane = 0; plane < SN54HC595_BAM_PLANES; plane++)
+			planes[plane * stride + byte] = columns[7 - plane];
+	}
+}
+
+int8_t SN54HC595_bam_init(SN54HC595_bam_t* bam)
+{
+	if(bam->array->dev_count > SN54HC595_BAM_MAX_BYTES ||
+			bam->base_period == 0 ||
+			((uint32_t)bam->base_period << (SN54HC595_BAM_PLANES - 1)) > 0x10000)
+		return -1;
+
+	memset(bam->levels, 0, sizeof(bam->levels));
+	memset(bam->planes, 0, sizeof(bam->planes));
+	bam->front = 0;
+	bam->swap = 0;
+	bam->plane = SN54HC595_BAM_PLANES - 1;
+	bam->out_buf = bam->array->out_buf;
+
+	return 0;
+}
+
+void SN54HC595_bam_set(SN54HC595_bam_t* bam, uint16_t output, uint8_t level)
+{
+	if(output < bam->array->dev_count * 8)
+		bam->levels[output] = level;
+}
+
+void SN54HC595_bam_commit(SN54HC595_bam_t* bam)
+{
+	//take back a commit the tick has not swapped in yet, so that it cannot
+	//swap while the back planes are being rebuilt
+	bam->swap = 0;
+
+	SN54HC595_bam_build_planes(bam->levels, &bam->planes[!bam->front][0][0],
+			bam->array->dev_count, SN54HC595_BAM_MAX_BYTES);
+
+	bam->swap = 1;
+}
+
+void SN54HC595_bam_tick(SN54HC595_bam_t* bam)
+{
+	shift_array_t* array = bam->array;
+	uint8_t plane;
+
+#ifdef USE_SN54HC595_SPI
+	//never wait in the interrupt, the plane still on shows one period longer
+	if(array->spi != NULL && array->busy)
+		return;
+#endif
+
+	plane = bam->plane + 1;
+	if(plane >= SN54HC595_BAM_PLANES){
+		plane = 0;
+		if(bam->swap){
+			bam->front = !bam->front;
+			bam->swap = 0;
+		}
+	}
+	bam->plane = plane;
+
+	//plane b stays on for 2^b base periods, set before the shift since
+	//without preload a counter already past ARR would run on to 65536
+	__HAL_TIM_SET_AUTORELOAD(bam->timer, ((uint32_t)bam->base_period << plane) - 1);
+
+	array->out_buf = bam->planes[bam->front][plane];
+	array->output(array, array->dev_count);
+}
+
+void SN54HC595_bam_stop(SN54HC595_bam_t* bam)
+{
+	shift_array_t* array = bam->array;
+
+#ifdef USE_SN54HC595_SPI
+	if(array->spi != NULL)
+		SN54HC595_spi_flush(array);
+#endif
+
+	array->out_buf = bam->out_buf;
+	memset(array->out_buf, 0, array->dev_count);
+	array->output(array, array->dev_count);
+}
+
+#endif
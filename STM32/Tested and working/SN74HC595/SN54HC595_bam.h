@@ -0,0 +1,161 @@
+/**
+ * @file SN54HC595_bam.h
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @copyright GNU GPL v3
+ * @brief   Bit angle modulation dimming for SN54HC595 shift registers
+ *	
+ *	Binary angle modulation gives every output of a chain its own 8 bit
+ *	brightness with 8 chain loads per cycle. The brightness values are
+ *	turned into 8 bit planes, plane b holding bit b of every output, and
+ *	plane b is shown for 2^b timer slots, so an output with level L is on
+ *	for L of the 255 slots of a cycle. The planes are built 8 outputs at a
+ *	time with SN54HC595_transpose8.
+ *
+ *	The timer's auto reload is rewritten every tick to the length of the
+ *	next plane, so auto reload preload must be disabled. base_period is
+ *	the timer period of plane 0 and must be longer than one chain load,
+ *	plane 7 is 128 times as long, so base_period is at most 512.
+ *
+ *	Usage, 1 MHz timer, 4 us base period, ~980 Hz cycle:
+ *	SN54HC595_bam_t bam = { .array = &shift_array, .timer = &htim7,
+ *		.base_period = 4 };
+ *	SN54HC595_bam_init(&bam);
+ *	HAL_TIM_Base_Start_IT(&htim7);
+ *	...
+ *	void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+ *	{
+ *		if(htim == &htim7)
+ *			SN54HC595_bam_tick(&bam);
+ *	}
+ *	...
+ *	SN54HC595_bam_set(&bam, 12, 40);
+ *	SN54HC595_bam_commit(&bam);
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef SN54HC595_BAM_H_
+#define SN54HC595_BAM_H_
+
+#include "SN54HC595.h"
+
+#ifdef USE_SN54HC595_STRUCTS
+
+/**
+* @brief Longest chain bit angle modulation can drive
+*/
+#define SN54HC595_BAM_MAX_BYTES		16
+
+/**
+* @brief Number of bit planes, one per brightness bit
+*/
+#define SN54HC595_BAM_PLANES		8
+
+/**
+* @typedef SN54HC595_bam_t
+* @brief Typedef for SN54HC595_bam
+*/
+typedef struct SN54HC595_bam SN54HC595_bam_t;
+/**
+* @struct SN54HC595_bam
+* @brief Bit angle modulation on a shift array
+*/
+struct SN54HC595_bam{
+	shift_array_t* array;	/**< Initialised shift array*/
+	TIM_HandleTypeDef* timer;	/**< Timer whose update calls SN54HC595_bam_tick*/
+	uint16_t base_period;	/**< Timer counts plane 0 is shown for*/
+
+	uint8_t levels[SN54HC595_BAM_MAX_BYTES * 8];	/**< Brightness of output n
+						(byte n / 8, bit n % 8), 0 off, 255 fully on*/
+	uint8_t planes[2][SN54HC595_BAM_PLANES][SN54HC595_BAM_MAX_BYTES];
+	volatile uint8_t front;	/**< Planes being shown*/
+	volatile uint8_t swap;	/**< Back planes ready, swapped at the start of a cycle*/
+	uint8_t plane;			/**< Plane on show*/
+
+	uint8_t* out_buf;		/**< The array's own buffer, given back by SN54HC595_bam_stop*/
+};
+
+/**
+* @brief Starts with every output off
+*
+* The shift array's output buffer is replaced by the bit planes until
+* SN54HC595_bam_stop.
+*
+* @param bam Pointer to the BAM engine, array, timer and base_period set
+* @return 0 on success, -1 if the chain is too long or base_period does
+* not fit the timer
+*/
+int8_t SN54HC595_bam_init(SN54HC595_bam_t* bam);
+
+/**
+* @brief Sets the brightness of one output, shown after SN54HC595_bam_commit
+*
+* @param bam Pointer to the BAM engine
+* @param output Output index, 8 per register, 0 is bit 0 of out_buf[0]
+* @param level Brightness, 0 to 255
+* @return void
+*/
+void SN54HC595_bam_set(SN54HC595_bam_t* bam, uint16_t output, uint8_t level);
+
+/**
+* @brief Builds the bit planes from the levels and queues them for the
+* next cycle
+*
+* @param bam Pointer to the BAM engine
+* @return void
+*/
+void SN54HC595_bam_commit(SN54HC595_bam_t* bam);
+
+/**
+* @brief Builds bit planes from brightness levels
+*
+* @param levels bytes * 8 levels
+* @param planes SN54HC595_BAM_PLANES planes of stride bytes, only the
+* first bytes of each are written
+* @param bytes Chain length
+* @param stride Bytes between planes
+* @return void
+*/
+void SN54HC595_bam_build_planes(const uint8_t* levels, uint8_t* planes,
+	uint8_t bytes, uint8_t stride);
+
+/**
+* @brief Shows the next plane, call from the timer's period elapsed callback
+*
+* @param bam Pointer to the BAM engine
+* @return void
+*/
+void SN54HC595_bam_tick(SN54HC595_bam_t* bam);
+
+/**
+* @brief Turns every output off and gives the shift array its buffer back
+*
+* Stop the timer first.
+*
+* @param bam Pointer to the BAM engine
+* @return void
+*/
+void SN54HC595_bam_stop(SN54HC595_bam_t* bam);
+
+#endif
+
+#endif /* SN54HC595_BAM_H_ */
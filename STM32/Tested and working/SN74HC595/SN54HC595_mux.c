@@ -0,0 +1,127 @@
+/**
+ * @file SN54HC595_mux.c
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @copyright GNU GPL v3
+ * @brief   Timer driven multiplexed display refresh on SN54HC595 shift registers
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <string.h>
+
+#include "SN54HC595_mux.h"
+
+#ifdef USE_SN54HC595_STRUCTS
+
+int8_t SN54HC595_mux_init(SN54HC595_mux_t* mux)
+{
+	uint8_t bytes = mux->array->dev_count;
+
+	if(mux->digit_count == 0 || mux->digit_count > SN54HC595_MUX_MAX_DIGITS ||
+			bytes > SN54HC595_MUX_MAX_BYTES || mux->select == NULL ||
+			mux->glyph_bytes == 0 || mux->glyph_byte + mux->glyph_bytes > bytes)
+		return -1;
+
+	//a raw value is a single byte
+	if(mux->glyphs == NULL && mux->glyph_bytes != 1)
+		return -1;
+
+	for(uint8_t digit = 0; digit < mux->digit_count; digit++)
+		memcpy(mux->frames[digit], &mux->select[digit * bytes], bytes);
+
+	mux->digit = 0;
+	mux->overruns = 0;
+	mux->out_buf = mux->array->out_buf;
+
+	return 0;
+}
+
+void SN54HC595_mux_tick(SN54HC595_mux_t* mux)
+{
+	shift_array_t* array = mux->array;
+	uint8_t digit;
+
+#ifdef USE_SN54HC595_SPI
+	//never wait in the interrupt, show this digit for one more tick
+	if(array->spi != NULL && array->busy){
+		mux->overruns++;
+		return;
+	}
+#endif
+
+	digit = mux->digit + 1;
+	if(digit >= mux->digit_count)
+		digit = 0;
+	mux->digit = digit;
+
+	//a DMA transfer reads tx until it ends, set_raw only writes frames
+	memcpy(mux->tx, mux->frames[digit], array->dev_count);
+	array->out_buf = mux->tx;
+	array->output(array, array->dev_count);
+}
+
+void SN54HC595_mux_set_raw(SN54HC595_mux_t* mux, uint8_t digit,
+	const uint8_t* pattern)
+{
+	const uint8_t* select;
+	uint8_t* frame;
+	uint32_t primask;
+
+	if(digit >= mux->digit_count)
+		return;
+
+	select = &mux->select[digit * mux->array->dev_count + mux->glyph_byte];
+	frame = &mux->frames[digit][mux->glyph_byte];
+
+	//the tick must not copy out half a glyph
+	primask = __get_PRIMASK();
+	__disable_irq();
+	for(uint8_t i = 0; i < mux->glyph_bytes; i++)
+		frame[i] = select[i] | (pattern != NULL ? pattern[i] : 0);
+	__set_PRIMASK(primask);
+}
+
+void SN54HC595_mux_set_digit(SN54HC595_mux_t* mux, uint8_t digit, uint8_t value)
+{
+	if(mux->glyphs == NULL)
+		SN54HC595_mux_set_raw(mux, digit, &value);
+	else if(value < mux->glyph_count)
+		SN54HC595_mux_set_raw(mux, digit, &mux->glyphs[value * mux->glyph_bytes]);
+	else
+		SN54HC595_mux_set_raw(mux, digit, NULL);
+}
+
+void SN54HC595_mux_stop(SN54HC595_mux_t* mux)
+{
+	shift_array_t* array = mux->array;
+
+#ifdef USE_SN54HC595_SPI
+	if(array->spi != NULL)
+		SN54HC595_spi_flush(array);
+#endif
+
+	array->out_buf = mux->out_buf;
+	memset(array->out_buf, 0, array->dev_count);
+	array->output(array, array->dev_count);
+}
+
+#endif
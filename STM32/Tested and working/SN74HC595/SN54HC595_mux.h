@@ -0,0 +1,157 @@
+/**
+ * @file SN54HC595_mux.h
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @copyright GNU GPL v3
+ * @brief   Timer driven multiplexed display refresh on SN54HC595 shift registers
+ *	
+ *	Refreshes multiplexed 7 segment or nixie digits from a timer interrupt.
+ *	The frame table holds one complete chain load per digit, its digit
+ *	select bits and its glyph. Every timer tick shifts out the next digit's
+ *	frame with the array's output and latches it. With the SPI output that
+ *	is one DMA transfer per tick. The refresh rate is set by the timer, not
+ *	by the main loop, so brightness does not depend on foreground load.
+ *	The application only writes digit values.
+ *
+ *	Usage, 4 digits, segments in byte 1, digit selects in byte 0:
+ *	static const uint8_t select[4][2] = {{0x01,0}, {0x02,0}, {0x04,0}, {0x08,0}};
+ *	SN54HC595_mux_t mux = {
+ *		.array = &shift_array, .digit_count = 4,
+ *		.select = &select[0][0], .glyph_byte = 1, .glyph_bytes = 1,
+ *		.glyphs = seven_segment_font, .glyph_count = 10
+ *	};
+ *	SN54HC595_mux_init(&mux);
+ *	HAL_TIM_Base_Start_IT(&htim6);	//eg. 1 kHz, 250 Hz per digit
+ *	...
+ *	void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+ *	{
+ *		if(htim == &htim6)
+ *			SN54HC595_mux_tick(&mux);
+ *	}
+ *	...
+ *	SN54HC595_mux_set_digit(&mux, 0, 7);
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef SN54HC595_MUX_H_
+#define SN54HC595_MUX_H_
+
+#include "SN54HC595.h"
+
+#ifdef USE_SN54HC595_STRUCTS
+
+/**
+* @brief Most digits a multiplexer can drive
+*/
+#define SN54HC595_MUX_MAX_DIGITS		16
+/**
+* @brief Longest chain a multiplexer can drive
+*/
+#define SN54HC595_MUX_MAX_BYTES			8
+
+/**
+* @typedef SN54HC595_mux_t
+* @brief Typedef for SN54HC595_mux
+*/
+typedef struct SN54HC595_mux SN54HC595_mux_t;
+/**
+* @struct SN54HC595_mux
+* @brief Timer driven digit multiplexer on a shift array
+*/
+struct SN54HC595_mux{
+	shift_array_t* array;	/**< Initialised shift array, dev_count bytes per frame*/
+	uint8_t digit_count;
+
+	const uint8_t* select;	/**< digit_count x dev_count bytes, the bits that
+						turn each digit on, ORed into its frame*/
+	uint8_t glyph_byte;		/**< First frame byte of the glyph*/
+	uint8_t glyph_bytes;	/**< Bytes per glyph, 1 for 7 segments, 2 for 10 nixie cathodes*/
+	const uint8_t* glyphs;	/**< glyph_bytes per value, NULL to take values as raw patterns*/
+	uint8_t glyph_count;	/**< Values in glyphs*/
+
+	uint8_t frames[SN54HC595_MUX_MAX_DIGITS][SN54HC595_MUX_MAX_BYTES]; /**< Frame table*/
+	uint8_t tx[SN54HC595_MUX_MAX_BYTES];	/**< Copy of the frame on show, the
+						only buffer the output reads*/
+	volatile uint8_t digit;	/**< Digit on show*/
+	uint32_t overruns;		/**< Ticks skipped because a DMA transfer was still running*/
+
+	uint8_t* out_buf;		/**< The array's own buffer, given back by SN54HC595_mux_stop*/
+};
+
+/**
+* @brief Builds the frame table with every digit blank
+*
+* The shift array's output buffer is replaced by the multiplexer's until
+* SN54HC595_mux_stop, the array must not be used by anything else
+* meanwhile.
+*
+* @param mux Pointer to the multiplexer, the configuration fields set
+* @return 0 on success, -1 if the configuration does not fit
+*/
+int8_t SN54HC595_mux_init(SN54HC595_mux_t* mux);
+
+/**
+* @brief Shows the next digit, call from the timer's period elapsed callback
+*
+* @param mux Pointer to the multiplexer
+* @return void
+*/
+void SN54HC595_mux_tick(SN54HC595_mux_t* mux);
+
+/**
+* @brief Sets a digit to a glyph
+*
+* @param mux Pointer to the multiplexer
+* @param digit Digit index, 0 is the digit of the first select row
+* @param value Index into glyphs, or the segment pattern itself if there
+* are no glyphs. Values past glyph_count blank the digit.
+* @return void
+*/
+void SN54HC595_mux_set_digit(SN54HC595_mux_t* mux, uint8_t digit, uint8_t value);
+
+/**
+* @brief Sets a digit to a raw pattern of glyph_bytes bytes
+*
+* Only the frame table is written, the tick copies the digit's frame to
+* tx before each output, so a DMA transfer in flight is never changed.
+*
+* @param mux Pointer to the multiplexer
+* @param digit Digit index
+* @param pattern glyph_bytes bytes, eg. to add a decimal point
+* @return void
+*/
+void SN54HC595_mux_set_raw(SN54HC595_mux_t* mux, uint8_t digit,
+	const uint8_t* pattern);
+
+/**
+* @brief Blanks the chain and gives the shift array its buffer back
+*
+* Stop the timer first.
+*
+* @param mux Pointer to the multiplexer
+* @return void
+*/
+void SN54HC595_mux_stop(SN54HC595_mux_t* mux);
+
+#endif
+
+#endif /* SN54HC595_MUX_H_ */
@@ -0,0 +1,121 @@
+/**
+ * @file SN54HC595_parallel.c
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @copyright GNU GPL v3
+ * @brief   Parallel SN54HC595 chains shifted from one GPIO port
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include "SN54HC595_parallel.h"
+#include "SN54HC595_fast.h"
+#include "SN54HC595_transpose.h"
+
+int8_t SN54HC595_parallel_init(SN54HC595_parallel_t* self)
+{
+	GPIO_InitTypeDef GPIO_InitStruct;
+
+	if(self->chain_count == 0 || self->chain_count > SN54HC595_PARALLEL_MAX_CHAINS)
+		return -1;
+
+	self->data_mask = 0;
+	for(uint8_t chain = 0; chain < self->chain_count; chain++)
+		self->data_mask |= self->data_pins[chain];
+
+	//pin_map[half][n] holds the data pins of the chains whose bit is set in n
+	for(uint8_t n = 0; n < 16; n++){
+		self->pin_map[0][n] = 0;
+		self->pin_map[1][n] = 0;
+		for(uint8_t bit = 0; bit < 4; bit++){
+			if(!(n & (1 << bit)))
+				continue;
+			if(bit < self->chain_count)
+				self->pin_map[0][n] |= self->data_pins[bit];
+			if(bit + 4 < self->chain_count)
+				self->pin_map[1][n] |= self->data_pins[bit + 4];
+		}
+	}
+
+	CLOCK_SWITCH(self->data_port);
+	CLOCK_SWITCH(self->clk_port);
+	CLOCK_SWITCH(self->latch_port);
+
+	GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+	GPIO_InitStruct.Pull = GPIO_NOPULL;
+	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+
+	/*Configure serial in */
+	GPIO_InitStruct.Pin = self->data_mask;
+	HAL_GPIO_Init(self->data_port, &GPIO_InitStruct);
+
+	/*Configure serial clock */
+	GPIO_InitStruct.Pin = self->clk_pin;
+	HAL_GPIO_Init(self->clk_port, &GPIO_InitStruct);
+
+	/*Configure latch pin */
+	GPIO_InitStruct.Pin = self->latch_pin;
+	HAL_GPIO_Init(self->latch_port, &GPIO_InitStruct);
+
+	SN54HC595_BSRR_WRITE(self->data_port, SN54HC595_RESET(self->data_mask));
+	SN54HC595_BSRR_WRITE(self->clk_port, SN54HC595_RESET(self->clk_pin));
+	SN54HC595_BSRR_WRITE(self->latch_port, SN54HC595_RESET(self->latch_pin));
+
+	return 0;
+}
+
+void SN54HC595_parallel_output(SN54HC595_parallel_t* self)
+{
+	uint32_t clk_low = (self->clk_port == self->data_port) ?
+			SN54HC595_RESET(self->clk_pin) : 0;
+	uint8_t rows[8] = {0}, columns[8];
+	uint32_t set;
+	int8_t j;
+
+	for(uint8_t i = 0; i < self->bytes; i++){
+		//row 7 - chain holds the chain's byte, so column j has the chain on bit chain
+		for(uint8_t chain = 0; chain < self->chain_count; chain++)
+			rows[7 - chain] = self->buffers[chain][i];
+
+		SN54HC595_transpose8(rows, columns);
+
+		//column j holds bit 7 - j of every chain
+		for(uint8_t k = 0; k < 8; k++){
+			j = (SN54HC595_BIT_ORDER == SN54HC595_LSB_FIRST) ? 7 - k : k;
+			set = self->pin_map[0][columns[j] & 0x0F] |
+					self->pin_map[1][columns[j] >> 4];
+
+			if(!clk_low)
+				SN54HC595_BSRR_WRITE(self->clk_port, SN54HC595_RESET(self->clk_pin));
+			SN54HC595_BSRR_WRITE(self->data_port, clk_low | set |
+					SN54HC595_RESET(self->data_mask & ~set));
+			SN54HC595_FAST_EDGE_DELAY();
+			SN54HC595_BSRR_WRITE(self->clk_port, SN54HC595_SET(self->clk_pin));
+			SN54HC595_FAST_EDGE_DELAY();
+		}
+	}
+
+	SN54HC595_BSRR_WRITE(self->clk_port, SN54HC595_RESET(self->clk_pin));
+	//one latch for every chain
+	SN54HC595_BSRR_WRITE(self->latch_port, SN54HC595_SET(self->latch_pin));
+	SN54HC595_FAST_EDGE_DELAY();
+	SN54HC595_BSRR_WRITE(self->latch_port, SN54HC595_RESET(self->latch_pin));
+}
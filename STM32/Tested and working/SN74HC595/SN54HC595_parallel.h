@@ -0,0 +1,108 @@
+/**
+ * @file SN54HC595_parallel.h
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @copyright GNU GPL v3
+ * @brief   Parallel SN54HC595 chains shifted from one GPIO port
+ *	
+ *	Shifts up to 8 chains at once. The chains share the serial clock and
+ *	latch, and their serial data pins are on one GPIO port. Each byte
+ *	position of the 8 chains is turned into 8 port patterns with
+ *	SN54HC595_transpose8, then every clock edge is a single BSRR store that
+ *	sets and resets all data pins together. Refreshing 8 chains takes as
+ *	long as refreshing one.
+ *
+ *	The data pins can be any pins of the port, they are mapped through two
+ *	16 entry tables built at init. When the serial clock is on the data
+ *	port too, the data and the falling clock edge go out in one store.
+ *
+ *	Usage:
+ *	SN54HC595_parallel_t chains = {
+ *		.data_port = GPIOE, .chain_count = 3,
+ *		.data_pins = {GPIO_PIN_0, GPIO_PIN_1, GPIO_PIN_4},
+ *		.clk_port = GPIOE, .clk_pin = GPIO_PIN_8,
+ *		.latch_port = GPIOE, .latch_pin = GPIO_PIN_9,
+ *		.bytes = 4, .buffers = {left, middle, right}
+ *	};
+ *	SN54HC595_parallel_init(&chains);
+ *	SN54HC595_parallel_output(&chains);
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef SN54HC595_PARALLEL_H_
+#define SN54HC595_PARALLEL_H_
+
+#include "SN54HC595.h"
+
+/**
+* @brief Most chains shifted together
+*/
+#define SN54HC595_PARALLEL_MAX_CHAINS	8
+
+/**
+* @typedef SN54HC595_parallel_t
+* @brief Typedef for SN54HC595_parallel
+*/
+typedef struct SN54HC595_parallel SN54HC595_parallel_t;
+/**
+* @struct SN54HC595_parallel
+* @brief Chains sharing a clock and latch with their data pins on one port
+*/
+struct SN54HC595_parallel{
+	GPIO_TypeDef* data_port;
+	uint16_t data_pins[SN54HC595_PARALLEL_MAX_CHAINS];	/**< Serial data pin of each chain*/
+	uint8_t chain_count;
+
+	GPIO_TypeDef* clk_port;	/**< Serial clock shared by the chains*/
+	uint16_t clk_pin;
+	GPIO_TypeDef* latch_port;	/**< Latch shared by the chains*/
+	uint16_t latch_pin;
+
+	uint8_t bytes;			/**< Registers per chain, every buffer must be
+						this long, on a shorter chain the first bytes
+						shift out past its far end*/
+	uint8_t* buffers[SN54HC595_PARALLEL_MAX_CHAINS];	/**< bytes bytes per
+						chain, byte 0 ends up furthest from the micro*/
+
+	uint16_t pin_map[2][16];	/**< Data pins of chains 0-3 and 4-7 by bit pattern*/
+	uint16_t data_mask;		/**< All data pins*/
+};
+
+/**
+* @brief Sets up the pins and pin tables
+*
+* @param self Pointer to the chains, configuration fields set
+* @return 0 on success, -1 if there are too many chains
+*/
+int8_t SN54HC595_parallel_init(SN54HC595_parallel_t* self);
+
+/**
+* @brief Shifts every chain's buffer out and latches them all at once
+*
+* Bits go out in SN54HC595_BIT_ORDER.
+*
+* @param self Pointer to the chains
+* @return void
+*/
+void SN54HC595_parallel_output(SN54HC595_parallel_t* self);
+
+#endif /* SN54HC595_PARALLEL_H_ */
@@ -0,0 +1,85 @@
+/**
+ * @file SN54HC595_transpose.h
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @copyright GNU GPL v3
+ * @brief   Bit matrix transpose for SN54HC595 outputs
+ *	
+ *	8x8 bit matrix transpose shared by the bit angle modulation and the
+ *	parallel chain outputs. Works on two 32 bit words, three rounds of
+ *	masked swaps, so it stays cheap on Cortex-M cores without 64 bit
+ *	registers.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef SN54HC595_TRANSPOSE_H_
+#define SN54HC595_TRANSPOSE_H_
+
+#include <stdint.h>
+
+/**
+* @brief Transposes an 8x8 bit matrix
+*
+* Bit 7 is column 0, so bit (7 - i) of out[j] is bit (7 - j) of in[i].
+* in and out may be the same buffer.
+*
+* @param in 8 rows
+* @param out 8 columns
+* @return void
+*/
+static inline void SN54HC595_transpose8(const uint8_t* in, uint8_t* out)
+{
+	uint32_t x, y, t;
+
+	x = ((uint32_t)in[0] << 24) | ((uint32_t)in[1] << 16) |
+			((uint32_t)in[2] << 8) | in[3];
+	y = ((uint32_t)in[4] << 24) | ((uint32_t)in[5] << 16) |
+			((uint32_t)in[6] << 8) | in[7];
+
+	//swap 1x1 blocks within 2x2
+	t = (x ^ (x >> 7)) & 0x00AA00AA;
+	x = x ^ t ^ (t << 7);
+	t = (y ^ (y >> 7)) & 0x00AA00AA;
+	y = y ^ t ^ (t << 7);
+
+	//swap 2x2 blocks within 4x4
+	t = (x ^ (x >> 14)) & 0x0000CCCC;
+	x = x ^ t ^ (t << 14);
+	t = (y ^ (y >> 14)) & 0x0000CCCC;
+	y = y ^ t ^ (t << 14);
+
+	//swap 4x4 blocks
+	t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+	y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+	x = t;
+
+	out[0] = x >> 24;
+	out[1] = x >> 16;
+	out[2] = x >> 8;
+	out[3] = x;
+	out[4] = y >> 24;
+	out[5] = y >> 16;
+	out[6] = y >> 8;
+	out[7] = y;
+}
+
+#endif /* SN54HC595_TRANSPOSE_H_ */
@@ -0,0 +1,204 @@
+/**
+ * @file sn54hc595_backend_bench.c
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @copyright GNU GPL v3
+ * @brief   Host comparison of the SN54HC595 output backends on the timing model
+ *	
+ *	Drives 4 byte chains through every backend with chip models attached
+ *	and prints the edges and stores per frame, the frame time at the
+ *	simulated core clock and the timing violations:
+ *	output_self (HAL), the BSRR fast output, 8 chains in parallel, the
+ *	multiplexer (per digit tick) and bit angle modulation (per plane).
+ *	Returns non zero if a chain ends up with the wrong data or any
+ *	timing is violated.
+ *
+ *	Build and run from the SN74HC595 directory, optionally with the core
+ *	clock in Hz and a VCD file for the HAL frame:
+ *	gcc -O2 -Wall -Wextra -Ihost -I. host/sn54hc595_backend_bench.c \
+ *		SN54HC595.c SN54HC595_parallel.c SN54HC595_mux.c SN54HC595_bam.c \
+ *		host/sn54hc595_host.c -o backend_bench
+ *	./backend_bench 168000000 hal.vcd
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sn54hc595_host.h"
+#include "SN54HC595_fast.h"
+#include "SN54HC595_parallel.h"
+#include "SN54HC595_mux.h"
+#include "SN54HC595_bam.h"
+
+#define BYTES		4
+#define CHAINS		8
+#define DIGITS		4
+
+SN54HC595_DEFINE_FAST_OUTPUT(fast_out, GPIOG, GPIO_PIN_0, GPIOG, GPIO_PIN_1,
+		GPIOG, GPIO_PIN_2)
+
+static const uint8_t data[BYTES] = {0xA5, 0x3C, 0x81, 0x7E};
+
+static uint8_t report(const char* name, uint32_t frames, uint8_t data_ok)
+{
+	uint32_t violations = sn54hc595_host_violations();
+	uint8_t failed = violations || !data_ok;
+
+	printf("%-24s edges/frame %6.1f stores/frame %6.1f frame %8.2f us "
+			"violations %u%s\n", name,
+			(double)sn54hc595_host_stats.edges / frames,
+			(double)sn54hc595_host_stats.stores / frames,
+			sn54hc595_host_time_ns() / 1000.0 / frames, violations,
+			failed ? " FAILED" : "");
+
+	return failed;
+}
+
+static uint8_t run_parallel(void)
+{
+	static sn54hc595_host_chip_t chips[CHAINS];
+	static uint8_t buffers[CHAINS][BYTES];
+	SN54HC595_parallel_t parallel = {
+		.data_port = GPIOE, .chain_count = CHAINS,
+		.clk_port = GPIOD, .clk_pin = GPIO_PIN_0,
+		.latch_port = GPIOD, .latch_pin = GPIO_PIN_1, .bytes = BYTES
+	};
+	uint8_t chain, byte, ok = 1;
+
+	sn54hc595_host_detach_all();
+	for(chain = 0; chain < CHAINS; chain++){
+		parallel.data_pins[chain] = 1 << (chain * 2);
+		parallel.buffers[chain] = buffers[chain];
+		for(byte = 0; byte < BYTES; byte++)
+			buffers[chain][byte] = rand();
+		chips[chain] = (sn54hc595_host_chip_t){
+			.ser_port = GPIOE, .ser_pin = parallel.data_pins[chain],
+			.clk_port = GPIOD, .clk_pin = GPIO_PIN_0,
+			.latch_port = GPIOD, .latch_pin = GPIO_PIN_1, .bytes = BYTES
+		};
+		sn54hc595_host_attach(&chips[chain]);
+	}
+
+	if(SN54HC595_parallel_init(&parallel))
+		return 1;
+	sn54hc595_host_reset();
+	SN54HC595_parallel_output(&parallel);
+
+	for(chain = 0; chain < CHAINS; chain++)
+		ok &= !memcmp(chips[chain].storage, buffers[chain], BYTES);
+
+	return report("parallel, 8 chains", 1, ok);
+}
+
+int main(int argc, char** argv)
+{
+	static const uint8_t select[DIGITS * BYTES] = {
+		1, 0, 0, 0,  2, 0, 0, 0,  4, 0, 0, 0,  8, 0, 0, 0
+	};
+	static const uint8_t segments[10] = {
+		0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F
+	};
+	sn54hc595_host_chip_t chip = {
+		.ser_port = GPIOG, .ser_pin = GPIO_PIN_0,
+		.clk_port = GPIOG, .clk_pin = GPIO_PIN_1,
+		.latch_port = GPIOG, .latch_pin = GPIO_PIN_2, .bytes = BYTES
+	};
+	shift_array_t array = {
+		.dev_count = BYTES,
+		.ser_in_port = GPIOG, .ser_in_pin = GPIO_PIN_0,
+		.ser_clk_port = GPIOG, .ser_clk_pin = GPIO_PIN_1,
+		.latch_port = GPIOG, .latch_pin = GPIO_PIN_2,
+		.out_ena_port = GPIOF, .out_ena_pin = GPIO_PIN_1,
+		.sr_clr_port = GPIOF, .sr_clr_pin = GPIO_PIN_2
+	};
+	SN54HC595_mux_t mux = {
+		.array = &array, .digit_count = DIGITS, .select = select,
+		.glyph_byte = 1, .glyph_bytes = 1, .glyphs = segments,
+		.glyph_count = 10
+	};
+	TIM_TypeDef tim = {0};
+	TIM_HandleTypeDef htim = {&tim};
+	SN54HC595_bam_t bam = {.array = &array, .timer = &htim, .base_period = 10};
+	uint8_t failed = 0, i;
+
+	if(argc > 1)
+		sn54hc595_host_cpu_hz = strtoul(argv[1], NULL, 10);
+	printf("core clock %u Hz\n", sn54hc595_host_cpu_hz);
+
+	sn54hc595_host_attach(&chip);
+	SN54HC595_init_obj(&array);
+	memcpy(array.out_buf, data, BYTES);
+
+	sn54hc595_host_reset();
+	if(argc > 2){
+		sn54hc595_host_trace_pin(GPIOG, GPIO_PIN_0, "ser");
+		sn54hc595_host_trace_pin(GPIOG, GPIO_PIN_1, "srclk");
+		sn54hc595_host_trace_pin(GPIOG, GPIO_PIN_2, "rclk");
+		sn54hc595_host_trace_open(argv[2]);
+	}
+	array.output(&array, BYTES);
+	sn54hc595_host_trace_close();
+	failed |= report("output_self (HAL)", 1, !memcmp(chip.storage, data, BYTES));
+
+	sn54hc595_host_reset();
+	fast_out(data, BYTES);
+	failed |= report("BSRR fast output", 1, !memcmp(chip.storage, data, BYTES));
+
+	failed |= run_parallel();
+
+	sn54hc595_host_detach_all();
+	sn54hc595_host_attach(&chip);
+
+	if(SN54HC595_mux_init(&mux))
+		return 1;
+	for(i = 0; i < DIGITS; i++)
+		SN54HC595_mux_set_digit(&mux, i, i + 1);
+	sn54hc595_host_reset();
+	//a 1 ms timer tick per digit
+	for(i = 0; i < DIGITS; i++){
+		SN54HC595_mux_tick(&mux);
+		sn54hc595_host_advance_ns(1000000);
+	}
+	failed |= report("mux, per digit", DIGITS, chip.storage[0] == select[0] &&
+			chip.storage[1] == segments[1]);
+	printf("%24s latch period %llu ns, %.0f Hz refresh\n", "",
+			(unsigned long long)chip.latch_period_ns,
+			1e9 / (chip.latch_period_ns * (double)DIGITS));
+	SN54HC595_mux_stop(&mux);
+
+	if(SN54HC595_bam_init(&bam))
+		return 1;
+	for(i = 0; i < BYTES * 8; i++)
+		SN54HC595_bam_set(&bam, i, i * 8);
+	SN54HC595_bam_commit(&bam);
+	sn54hc595_host_reset();
+	for(i = 0; i < SN54HC595_BAM_PLANES; i++)
+		SN54HC595_bam_tick(&bam);
+	failed |= report("bam, per plane", SN54HC595_BAM_PLANES,
+			!memcmp(chip.storage, array.out_buf, BYTES));
+	SN54HC595_bam_stop(&bam);
+
+	printf(failed ? "FAILED\n" : "passed\n");
+	return failed;
+}
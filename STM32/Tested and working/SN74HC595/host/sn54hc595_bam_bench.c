@@ -0,0 +1,188 @@
+/**
+ * @file sn54hc595_bam_bench.c
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @copyright GNU GPL v3
+ * @brief   Host check and benchmark of the SN54HC595 bit plane build
+ *	
+ *	Checks SN54HC595_transpose8 bit by bit on 100000 random matrices, out
+ *	of place and in place, checks SN54HC595_bam_build_planes against a
+ *	per-bit loop and times both for a 16 byte chain. Then runs one BAM
+ *	cycle on the GPIO model and checks that every output is on for level
+ *	times base_period timer counts. Returns non zero on a mismatch.
+ *
+ *	Build and run from the SN74HC595 directory:
+ *	gcc -O2 -Wall -Wextra -Ihost -I. host/sn54hc595_bam_bench.c \
+ *		SN54HC595.c SN54HC595_bam.c host/sn54hc595_host.c -o bam_bench
+ *	./bam_bench
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sn54hc595_host.h"
+#include "SN54HC595_bam.h"
+#include "SN54HC595_transpose.h"
+
+#define MATRICES		100000
+#define BUILD_LOOPS		200000
+#define CHAIN_BYTES		16
+#define OUTPUTS			(CHAIN_BYTES * 8)
+#define BASE_PERIOD		4
+
+static double now_s(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+//what the plane build replaced, one bit at a time
+__attribute__((noinline)) static void build_planes_per_bit(
+		const uint8_t* levels, uint8_t* planes, uint8_t bytes, uint8_t stride)
+{
+	uint8_t plane, byte, bit, value;
+
+	for(plane = 0; plane < SN54HC595_BAM_PLANES; plane++)
+		for(byte = 0; byte < bytes; byte++){
+			value = 0;
+			for(bit = 0; bit < 8; bit++)
+				value |= ((levels[byte * 8 + bit] >> plane) & 1) << bit;
+			planes[plane * stride + byte] = value;
+		}
+}
+
+static uint32_t check_transpose(void)
+{
+	uint8_t in[8], out[8], same[8];
+	uint32_t bad = 0, n;
+	uint8_t i, j;
+
+	for(n = 0; n < MATRICES; n++){
+		for(i = 0; i < 8; i++)
+			in[i] = same[i] = rand();
+		SN54HC595_transpose8(in, out);
+		SN54HC595_transpose8(same, same);
+
+		for(i = 0; i < 8; i++)
+			for(j = 0; j < 8; j++)
+				if(((out[j] >> (7 - i)) & 1) != ((in[i] >> (7 - j)) & 1))
+					bad++;
+		if(memcmp(out, same, 8))
+			bad++;
+	}
+
+	return bad;
+}
+
+static uint32_t check_duty(void)
+{
+	TIM_TypeDef tim = {0};
+	TIM_HandleTypeDef htim = {&tim};
+	static uint32_t on[OUTPUTS];
+	shift_array_t array = {
+		.dev_count = CHAIN_BYTES,
+		.ser_in_port = SER_IN_PORT, .ser_in_pin = SER_IN_PIN,
+		.ser_clk_port = SER_CLK_PORT, .ser_clk_pin = SER_CLK_PIN,
+		.latch_port = LATCH_PORT, .latch_pin = LATCH_PIN,
+		.out_ena_port = GPIOF, .out_ena_pin = GPIO_PIN_1,
+		.sr_clr_port = GPIOF, .sr_clr_pin = GPIO_PIN_2
+	};
+	SN54HC595_bam_t bam = {.array = &array, .timer = &htim,
+			.base_period = BASE_PERIOD};
+	uint32_t bad = 0, counts;
+	uint16_t output;
+	uint8_t tick;
+
+	SN54HC595_init_obj(&array);
+	if(SN54HC595_bam_init(&bam))
+		return 1;
+
+	for(output = 0; output < OUTPUTS; output++)
+		SN54HC595_bam_set(&bam, output, (output * 37 + 5) & 0xFF);
+	SN54HC595_bam_commit(&bam);
+
+	//the first cycle swaps the planes in, count over the second
+	for(tick = 0; tick < 2 * SN54HC595_BAM_PLANES; tick++){
+		SN54HC595_bam_tick(&bam);
+		counts = tim.ARR + 1;
+		if(tick < SN54HC595_BAM_PLANES)
+			continue;
+		for(output = 0; output < OUTPUTS; output++)
+			if((array.out_buf[output / 8] >> (output % 8)) & 1)
+				on[output] += counts;
+	}
+
+	for(output = 0; output < OUTPUTS; output++)
+		if(on[output] != bam.levels[output] * (uint32_t)BASE_PERIOD)
+			bad++;
+
+	SN54HC595_bam_stop(&bam);
+
+	return bad;
+}
+
+int main(void)
+{
+	uint8_t levels[OUTPUTS], planes[SN54HC595_BAM_PLANES * CHAIN_BYTES];
+	uint8_t reference[SN54HC595_BAM_PLANES * CHAIN_BYTES];
+	uint32_t transpose_bad, plane_bad, duty_bad, i;
+	double start, transpose_ns, per_bit_ns;
+
+	srand(1);
+	transpose_bad = check_transpose();
+
+	for(i = 0; i < OUTPUTS; i++)
+		levels[i] = rand();
+	SN54HC595_bam_build_planes(levels, planes, CHAIN_BYTES, CHAIN_BYTES);
+	build_planes_per_bit(levels, reference, CHAIN_BYTES, CHAIN_BYTES);
+	plane_bad = memcmp(planes, reference, sizeof(planes)) != 0;
+
+	start = now_s();
+	for(i = 0; i < BUILD_LOOPS; i++){
+		levels[i % OUTPUTS] ^= i;
+		SN54HC595_bam_build_planes(levels, planes, CHAIN_BYTES, CHAIN_BYTES);
+	}
+	transpose_ns = (now_s() - start) / BUILD_LOOPS * 1e9;
+	start = now_s();
+	for(i = 0; i < BUILD_LOOPS; i++){
+		levels[i % OUTPUTS] ^= i;
+		build_planes_per_bit(levels, reference, CHAIN_BYTES, CHAIN_BYTES);
+	}
+	per_bit_ns = (now_s() - start) / BUILD_LOOPS * 1e9;
+
+	duty_bad = check_duty();
+
+	printf("transpose: %u mismatches over %u matrices\n", transpose_bad,
+			MATRICES);
+	printf("planes: %s the per-bit loop\n", plane_bad ? "differ from" :
+			"match");
+	printf("%u outputs: transpose %.0f ns, per-bit loop %.0f ns (%.1fx)\n",
+			OUTPUTS, transpose_ns, per_bit_ns, per_bit_ns / transpose_ns);
+	printf("duty: %u outputs off their level\n", duty_bad);
+
+	return transpose_bad || plane_bad || duty_bad;
+}
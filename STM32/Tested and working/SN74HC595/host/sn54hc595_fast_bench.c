@@ -0,0 +1,140 @@
+/**
+ * @file sn54hc595_fast_bench.c
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @copyright GNU GPL v3
+ * @brief   Host comparison of the HAL and BSRR SN54HC595 outputs
+ *	
+ *	Shifts a 16 byte frame out through output_self (HAL_GPIO_WritePin),
+ *	SN54HC595_out_bytes_fast on the pins in SN54HC595.h and a fast output
+ *	with SER and SRCLK on one port. For each it prints the HAL calls,
+ *	stores, edges and estimated cycles the GPIO model counts, the frame
+ *	time at the simulated core clock and the timing violations the chip
+ *	model saw. Returns non
+ *	zero if a chain ends up with the wrong data or a timing violation.
+ *
+ *	Build and run from the SN74HC595 directory, optionally with the core
+ *	clock in Hz:
+ *	gcc -O2 -Wall -Wextra -Ihost -I. host/sn54hc595_fast_bench.c \
+ *		SN54HC595.c host/sn54hc595_host.c -o fast_bench
+ *	./fast_bench 168000000
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sn54hc595_host.h"
+#include "SN54HC595_fast.h"
+
+#define FRAME_BYTES		16
+
+SN54HC595_DEFINE_FAST_OUTPUT(shared_out, GPIOB, GPIO_PIN_15, GPIOB,
+		GPIO_PIN_13, GPIOB, GPIO_PIN_12)
+
+static uint8_t frame[FRAME_BYTES];
+static shift_array_t array;
+
+static void hal_out(void)
+{
+	array.output(&array, FRAME_BYTES);
+}
+
+static void fast_out(void)
+{
+	SN54HC595_out_bytes_fast(frame, FRAME_BYTES);
+}
+
+static void shared_port_out(void)
+{
+	shared_out(frame, FRAME_BYTES);
+}
+
+static uint8_t run(const char* name, void (*out)(void),
+		sn54hc595_host_chip_t* chain)
+{
+	uint32_t violations;
+	uint8_t failed;
+
+	sn54hc595_host_detach_all();
+	sn54hc595_host_attach(chain);
+	sn54hc595_host_reset();
+	out();
+
+	violations = chain->setup_violations + chain->hold_violations +
+			chain->pulse_violations + chain->latch_violations;
+	failed = violations || memcmp(chain->storage, frame, FRAME_BYTES);
+
+	printf("%-18s calls %4u stores %4u edges %4u cycles %5u frame %6.2f us "
+			"violations %u%s\n", name, sn54hc595_host_stats.hal_calls,
+			sn54hc595_host_stats.stores, sn54hc595_host_stats.edges,
+			sn54hc595_host_cycles(), sn54hc595_host_time_ns() / 1000.0,
+			violations, failed ? " FAILED" : "");
+
+	return failed;
+}
+
+int main(int argc, char** argv)
+{
+	sn54hc595_host_chip_t split = {
+		.ser_port = SER_IN_PORT, .ser_pin = SER_IN_PIN,
+		.clk_port = SER_CLK_PORT, .clk_pin = SER_CLK_PIN,
+		.latch_port = LATCH_PORT, .latch_pin = LATCH_PIN,
+		.bytes = FRAME_BYTES
+	};
+	sn54hc595_host_chip_t shared = {
+		.ser_port = GPIOB, .ser_pin = GPIO_PIN_15,
+		.clk_port = GPIOB, .clk_pin = GPIO_PIN_13,
+		.latch_port = GPIOB, .latch_pin = GPIO_PIN_12,
+		.bytes = FRAME_BYTES
+	};
+	uint8_t failed = 0, i;
+
+	if(argc > 1)
+		sn54hc595_host_cpu_hz = strtoul(argv[1], NULL, 10);
+	printf("core clock %u Hz\n", sn54hc595_host_cpu_hz);
+
+	for(i = 0; i < FRAME_BYTES; i++)
+		frame[i] = i * 37;
+
+	array.dev_count = FRAME_BYTES;
+	array.ser_in_port = SER_IN_PORT;
+	array.ser_in_pin = SER_IN_PIN;
+	array.ser_clk_port = SER_CLK_PORT;
+	array.ser_clk_pin = SER_CLK_PIN;
+	array.latch_port = LATCH_PORT;
+	array.latch_pin = LATCH_PIN;
+	array.out_ena_port = GPIOF;
+	array.out_ena_pin = GPIO_PIN_1;
+	array.sr_clr_port = GPIOF;
+	array.sr_clr_pin = GPIO_PIN_2;
+	SN54HC595_init_obj(&array);
+	array.set_data(&array, frame);
+
+	failed |= run("output_self (HAL)", hal_out, &split);
+	failed |= run("BSRR split ports", fast_out, &split);
+	failed |= run("BSRR shared port", shared_port_out, &shared);
+
+	printf(failed ? "FAILED\n" : "passed\n");
+	return failed;
+}
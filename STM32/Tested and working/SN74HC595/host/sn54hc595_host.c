@@ -0,0 +1,369 @@
+/**
+ * @file sn54hc595_host.c
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @copyright GNU GPL v3
+ * @brief   GPIO model for running the SN54HC595 library on a host
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sn54hc595_host.h"
+
+//no change seen yet
+#define HOST_NEVER		UINT64_MAX
+
+GPIO_TypeDef sn54hc595_host_ports[SN54HC595_HOST_PORTS];
+sn54hc595_host_stats_t sn54hc595_host_stats;
+
+sn54hc595_host_timing_t sn54hc595_host_timing = {
+	.setup_ns = 20,
+	.hold_ns = 0,
+	.pulse_ns = 16,
+	.latch_setup_ns = 19
+};
+
+uint32_t sn54hc595_host_cpu_hz = 168000000;
+
+static uint64_t host_cycles = 0;
+
+static sn54hc595_host_chip_t* host_chips[SN54HC595_HOST_CHIPS];
+static uint8_t host_chip_count = 0;
+
+static struct {
+	GPIO_TypeDef* port;
+	uint16_t pin;
+	const char* name;
+} host_trace[SN54HC595_HOST_TRACE_PINS];
+static uint8_t host_trace_count = 0;
+static FILE* host_vcd = NULL;
+static uint64_t host_vcd_time = HOST_NEVER;
+
+static uint8_t popcount16(uint16_t value)
+{
+	uint8_t count = 0;
+
+	for(; value; value &= value - 1)
+		count++;
+
+	return count;
+}
+
+uint64_t sn54hc595_host_time_ns(void)
+{
+	return host_cycles * 1000000000ull / sn54hc595_host_cpu_hz;
+}
+
+void sn54hc595_host_advance_ns(uint64_t ns)
+{
+	host_cycles += ns * sn54hc595_host_cpu_hz / 1000000000ull;
+}
+
+static uint8_t pin_level(GPIO_TypeDef* port, uint16_t pin)
+{
+	return (port != NULL && (port->ODR & pin)) ? 1 : 0;
+}
+
+//VCD identifiers, pins first then one per chip
+static char vcd_id(uint8_t signal)
+{
+	return '!' + signal;
+}
+
+static void vcd_timestamp(uint64_t now)
+{
+	if(now != host_vcd_time){
+		fprintf(host_vcd, "#%llu\n", (unsigned long long)now);
+		host_vcd_time = now;
+	}
+}
+
+static void vcd_storage(uint8_t chip)
+{
+	sn54hc595_host_chip_t* model = host_chips[chip];
+
+	fputc('b', host_vcd);
+	for(uint8_t i = 0; i < model->bytes; i++)
+		for(uint8_t bit = 0; bit < 8; bit++)
+			fputc((model->storage[i] & (0x80 >> bit)) ? '1' : '0', host_vcd);
+	fprintf(host_vcd, " %c\n", vcd_id(SN54HC595_HOST_TRACE_PINS + chip));
+}
+
+static uint8_t too_soon(uint64_t now, uint64_t then, uint32_t min_ns)
+{
+	return then != HOST_NEVER && now - then < min_ns;
+}
+
+static void chip_update(uint8_t index, uint64_t now)
+{
+	sn54hc595_host_chip_t* chip = host_chips[index];
+	uint8_t ser = pin_level(chip->ser_port, chip->ser_pin);
+	uint8_t clk = pin_level(chip->clk_port, chip->clk_pin);
+	uint8_t latch = pin_level(chip->latch_port, chip->latch_pin);
+	uint8_t i;
+
+	if(ser != chip->ser){
+		if(too_soon(now, chip->shift_ns, sn54hc595_host_timing.hold_ns))
+			chip->hold_violations++;
+		chip->ser = ser;
+		chip->ser_ns = now;
+	}
+
+	if(clk != chip->clk){
+		if(too_soon(now, chip->clk_ns, sn54hc595_host_timing.pulse_ns))
+			chip->pulse_violations++;
+		if(clk){
+			//SER changing on the same store as the edge is a setup violation
+			if(too_soon(now, chip->ser_ns, sn54hc595_host_timing.setup_ns))
+				chip->setup_violations++;
+			for(i = 0; i < chip->bytes; i++)
+				chip->shift[i] = (chip->shift[i] << 1) |
+						((i + 1 < chip->bytes) ? chip->shift[i + 1] >> 7 : ser);
+			chip->shifts++;
+			chip->shift_ns = now;
+		}
+		chip->clk = clk;
+		chip->clk_ns = now;
+	}
+
+	//SRCLR is asynchronous and active low
+	if(chip->clr_port != NULL && !pin_level(chip->clr_port, chip->clr_pin))
+		memset(chip->shift, 0, sizeof(chip->shift));
+
+	if(latch != chip->latch){
+		if(too_soon(now, chip->latch_ns, sn54hc595_host_timing.pulse_ns))
+			chip->pulse_violations++;
+		if(latch){
+			if(too_soon(now, chip->shift_ns, sn54hc595_host_timing.latch_setup_ns))
+				chip->latch_violations++;
+			memcpy(chip->storage, chip->shift, chip->bytes);
+			if(chip->last_latch_ns != HOST_NEVER)
+				chip->latch_period_ns = now - chip->last_latch_ns;
+			chip->last_latch_ns = now;
+			chip->latches++;
+			if(host_vcd != NULL){
+				vcd_timestamp(now);
+				vcd_storage(index);
+			}
+		}
+		chip->latch = latch;
+		chip->latch_ns = now;
+	}
+}
+
+void sn54hc595_host_bsrr(GPIO_TypeDef* port, uint32_t mask)
+{
+	uint16_t set = mask & 0xFFFF;
+	//set wins when a pin is in both halves, as on the chip
+	uint16_t reset = (mask >> 16) & ~set;
+	uint32_t odr = (port->ODR | set) & ~reset;
+	uint32_t changed = port->ODR ^ odr;
+	uint64_t now = sn54hc595_host_time_ns();
+	uint8_t i;
+
+	sn54hc595_host_stats.stores++;
+	sn54hc595_host_stats.edges += popcount16(changed);
+
+	port->BSRR = mask;
+	port->ODR = odr;
+
+	if(host_vcd != NULL)
+		for(i = 0; i < host_trace_count; i++)
+			if(host_trace[i].port == port && (changed & host_trace[i].pin)){
+				vcd_timestamp(now);
+				fprintf(host_vcd, "%u%c\n", (odr & host_trace[i].pin) ? 1 : 0,
+						vcd_id(i));
+			}
+
+	if(changed)
+		for(i = 0; i < host_chip_count; i++)
+			chip_update(i, now);
+
+	host_cycles += SN54HC595_HOST_STORE_CYCLES;
+}
+
+void sn54hc595_host_nop(void)
+{
+	sn54hc595_host_stats.nops++;
+	host_cycles++;
+}
+
+static void chip_reset(sn54hc595_host_chip_t* chip)
+{
+	chip->shifts = 0;
+	chip->latches = 0;
+	chip->latch_period_ns = 0;
+	chip->setup_violations = 0;
+	chip->hold_violations = 0;
+	chip->pulse_violations = 0;
+	chip->latch_violations = 0;
+
+	chip->ser = pin_level(chip->ser_port, chip->ser_pin);
+	chip->clk = pin_level(chip->clk_port, chip->clk_pin);
+	chip->latch = pin_level(chip->latch_port, chip->latch_pin);
+	chip->ser_ns = HOST_NEVER;
+	chip->clk_ns = HOST_NEVER;
+	chip->latch_ns = HOST_NEVER;
+	chip->shift_ns = HOST_NEVER;
+	chip->last_latch_ns = HOST_NEVER;
+}
+
+void sn54hc595_host_reset(void)
+{
+	memset(sn54hc595_host_ports, 0, sizeof(sn54hc595_host_ports));
+	memset(&sn54hc595_host_stats, 0, sizeof(sn54hc595_host_stats));
+	host_cycles = 0;
+	host_vcd_time = HOST_NEVER;
+
+	for(uint8_t i = 0; i < host_chip_count; i++)
+		chip_reset(host_chips[i]);
+}
+
+uint32_t sn54hc595_host_cycles(void)
+{
+	uint32_t direct = sn54hc595_host_stats.stores - sn54hc595_host_stats.hal_calls;
+
+	return sn54hc595_host_stats.hal_calls * SN54HC595_HOST_HAL_CYCLES +
+			direct * SN54HC595_HOST_STORE_CYCLES + sn54hc595_host_stats.nops;
+}
+
+int8_t sn54hc595_host_attach(sn54hc595_host_chip_t* chip)
+{
+	if(host_chip_count >= SN54HC595_HOST_CHIPS)
+		return -1;
+
+	if(chip->bytes > SN54HC595_HOST_CHIP_BYTES)
+		chip->bytes = SN54HC595_HOST_CHIP_BYTES;
+
+	memset(chip->shift, 0, sizeof(chip->shift));
+	memset(chip->storage, 0, sizeof(chip->storage));
+	chip_reset(chip);
+	host_chips[host_chip_count++] = chip;
+
+	return 0;
+}
+
+void sn54hc595_host_detach_all(void)
+{
+	host_chip_count = 0;
+}
+
+uint32_t sn54hc595_host_violations(void)
+{
+	uint32_t violations = 0;
+
+	for(uint8_t i = 0; i < host_chip_count; i++)
+		violations += host_chips[i]->setup_violations +
+				host_chips[i]->hold_violations +
+				host_chips[i]->pulse_violations +
+				host_chips[i]->latch_violations;
+
+	return violations;
+}
+
+int8_t sn54hc595_host_trace_pin(GPIO_TypeDef* port, uint16_t pin,
+		const char* name)
+{
+	if(host_trace_count >= SN54HC595_HOST_TRACE_PINS)
+		return -1;
+
+	host_trace[host_trace_count].port = port;
+	host_trace[host_trace_count].pin = pin;
+	host_trace[host_trace_count].name = name;
+	host_trace_count++;
+
+	return 0;
+}
+
+int8_t sn54hc595_host_trace_open(const char* path)
+{
+	uint8_t i;
+
+	host_vcd = fopen(path, "w");
+	if(host_vcd == NULL)
+		return -1;
+
+	fprintf(host_vcd, "$timescale 1ns $end\n$scope module sn54hc595 $end\n");
+	for(i = 0; i < host_trace_count; i++)
+		fprintf(host_vcd, "$var wire 1 %c %s $end\n", vcd_id(i),
+				host_trace[i].name);
+	for(i = 0; i < host_chip_count; i++)
+		fprintf(host_vcd, "$var wire %u %c chip%u_q $end\n",
+				host_chips[i]->bytes * 8,
+				vcd_id(SN54HC595_HOST_TRACE_PINS + i), i);
+	fprintf(host_vcd, "$upscope $end\n$enddefinitions $end\n");
+
+	host_vcd_time = HOST_NEVER;
+	vcd_timestamp(sn54hc595_host_time_ns());
+	fprintf(host_vcd, "$dumpvars\n");
+	for(i = 0; i < host_trace_count; i++)
+		fprintf(host_vcd, "%u%c\n",
+				pin_level(host_trace[i].port, host_trace[i].pin), vcd_id(i));
+	for(i = 0; i < host_chip_count; i++)
+		vcd_storage(i);
+	fprintf(host_vcd, "$end\n");
+
+	return 0;
+}
+
+void sn54hc595_host_trace_close(void)
+{
+	if(host_vcd != NULL){
+		vcd_timestamp(sn54hc595_host_time_ns());
+		fclose(host_vcd);
+		host_vcd = NULL;
+	}
+
+	host_trace_count = 0;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init)
+{
+	(void)GPIOx;
+	(void)GPIO_Init;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin,
+		GPIO_PinState PinState)
+{
+	sn54hc595_host_stats.hal_calls++;
+	//call overhead before the store
+	host_cycles += SN54HC595_HOST_HAL_CYCLES - SN54HC595_HOST_STORE_CYCLES;
+
+	//same store the HAL makes
+	if(PinState != GPIO_PIN_RESET)
+		sn54hc595_host_bsrr(GPIOx, GPIO_Pin);
+	else
+		sn54hc595_host_bsrr(GPIOx, (uint32_t)GPIO_Pin << 16);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+	host_cycles += (uint64_t)Delay * (sn54hc595_host_cpu_hz / 1000);
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return (uint32_t)(sn54hc595_host_time_ns() / 1000000);
+}
@@ -0,0 +1,218 @@
+/**
+ * @file sn54hc595_host.h
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @copyright GNU GPL v3
+ * @brief   GPIO model for running the SN54HC595 library on a host
+ *	
+ *	Counts the GPIO traffic of the SN54HC595 outputs so the backends can be
+ *	compared without hardware. Every HAL_GPIO_WritePin call and every
+ *	direct BSRR store is counted, along with the pin edges they cause,
+ *	and an estimate of the Cortex-M cycles spent is kept from a fixed cost
+ *	per HAL call and per store.
+ *
+ *	Usage:
+ *	sn54hc595_host_reset();
+ *	SN54HC595_out_bytes_fast(frame, 16);
+ *	sn54hc595_host_stats.edges, sn54hc595_host_cycles()
+ *
+ *	The same costs drive a simulated clock, so every store has a
+ *	timestamp at sn54hc595_host_cpu_hz. Attached chip models watch the
+ *	pins like a chain of 74HC595s would: SER is shifted in on SRCLK rising,
+ *	RCLK rising copies the shift registers to the storage registers and
+ *	SRCLR low clears them. The models check SER setup and hold around
+ *	SRCLK, SRCLK to RCLK setup and the pulse widths against
+ *	sn54hc595_host_timing and count every violation. Traced pins and the
+ *	chips' storage registers can be written to a VCD file for a waveform
+ *	viewer.
+ *
+ *	sn54hc595_host_chip_t chain = {
+ *		.ser_port = GPIOG, .ser_pin = GPIO_PIN_0,
+ *		.clk_port = GPIOG, .clk_pin = GPIO_PIN_1,
+ *		.latch_port = GPIOG, .latch_pin = GPIO_PIN_2, .bytes = 2
+ *	};
+ *	sn54hc595_host_attach(&chain);
+ *	sn54hc595_host_trace_pin(GPIOG, GPIO_PIN_1, "srclk");
+ *	sn54hc595_host_trace_open("chain.vcd");
+ *	...drive the chain...
+ *	sn54hc595_host_trace_close();
+ *	chain.storage, chain.setup_violations
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef SN54HC595_HOST_H_
+#define SN54HC595_HOST_H_
+
+#include "stm32f4xx_hal.h"
+
+/**
+* @brief Estimated cycles of a HAL_GPIO_WritePin call on a Cortex-M3/M4,
+* call, compare, store and return with pipeline refills
+*/
+#define SN54HC595_HOST_HAL_CYCLES		12
+/**
+* @brief Estimated cycles of an inlined BSRR store
+*/
+#define SN54HC595_HOST_STORE_CYCLES		2
+
+/**
+* @brief Most chip models attached at once
+*/
+#define SN54HC595_HOST_CHIPS			8
+/**
+* @brief Registers per chip model
+*/
+#define SN54HC595_HOST_CHIP_BYTES		16
+/**
+* @brief Most pins traced to a VCD file
+*/
+#define SN54HC595_HOST_TRACE_PINS		32
+
+typedef struct {
+	uint32_t hal_calls;		/**< HAL_GPIO_WritePin calls*/
+	uint32_t stores;		/**< BSRR stores, including those made by HAL calls*/
+	uint32_t edges;			/**< Pin level changes*/
+	uint32_t nops;			/**< __NOP cycles waited by SN54HC595_FAST_EDGE_DELAY*/
+} sn54hc595_host_stats_t;
+
+extern sn54hc595_host_stats_t sn54hc595_host_stats;
+
+/**
+* @brief Timing the chip models check, in ns
+*
+* Defaults are the 74HC595 datasheet minimums at 4.5V, 25C.
+*/
+typedef struct {
+	uint32_t setup_ns;		/**< SER stable before SRCLK rises*/
+	uint32_t hold_ns;		/**< SER stable after SRCLK rises*/
+	uint32_t pulse_ns;		/**< Shortest high or low time of SRCLK and RCLK*/
+	uint32_t latch_setup_ns;	/**< Last SRCLK rising to RCLK rising*/
+} sn54hc595_host_timing_t;
+
+extern sn54hc595_host_timing_t sn54hc595_host_timing;
+
+/**
+* @brief Simulated core clock, 168MHz by default
+*/
+extern uint32_t sn54hc595_host_cpu_hz;
+
+/**
+* @typedef sn54hc595_host_chip_t
+* @brief Typedef for sn54hc595_host_chip
+*/
+typedef struct sn54hc595_host_chip sn54hc595_host_chip_t;
+/**
+* @struct sn54hc595_host_chip
+* @brief Model of a chain of 74HC595s on the port model
+*/
+struct sn54hc595_host_chip{
+	GPIO_TypeDef* ser_port;
+	uint16_t ser_pin;
+	GPIO_TypeDef* clk_port;
+	uint16_t clk_pin;
+	GPIO_TypeDef* latch_port;
+	uint16_t latch_pin;
+	GPIO_TypeDef* clr_port;	/**< NULL when SRCLR is tied high*/
+	uint16_t clr_pin;
+	uint8_t bytes;			/**< Registers in the chain*/
+
+	uint8_t shift[SN54HC595_HOST_CHIP_BYTES];	/**< Shift registers, 0 is
+						furthest from the micro*/
+	uint8_t storage[SN54HC595_HOST_CHIP_BYTES];	/**< Outputs*/
+
+	uint32_t shifts;		/**< SRCLK rising edges*/
+	uint32_t latches;		/**< RCLK rising edges*/
+	uint64_t latch_period_ns;	/**< Time between the last two latches*/
+
+	uint32_t setup_violations;
+	uint32_t hold_violations;
+	uint32_t pulse_violations;
+	uint32_t latch_violations;
+
+	//pin levels and when they last changed
+	uint8_t ser, clk, latch;
+	uint64_t ser_ns, clk_ns, latch_ns, shift_ns, last_latch_ns;
+};
+
+/**
+* @brief Clears the counters and drives every pin low
+*/
+void sn54hc595_host_reset(void);
+
+/**
+* @brief Estimated MCU cycles spent on GPIO since the last reset
+*/
+uint32_t sn54hc595_host_cycles(void);
+
+/**
+* @brief Simulated time since the last reset, in ns
+*/
+uint64_t sn54hc595_host_time_ns(void);
+
+/**
+* @brief Moves the simulated time on, eg. between timer ticks
+*/
+void sn54hc595_host_advance_ns(uint64_t ns);
+
+/**
+* @brief Connects a chip model to the port model
+*
+* The model's registers and counters are cleared. sn54hc595_host_reset
+* clears the counters again but keeps the chips attached.
+*
+* @param chip Pointer to the model, pins and bytes set
+* @return 0 on success, -1 if SN54HC595_HOST_CHIPS are attached
+*/
+int8_t sn54hc595_host_attach(sn54hc595_host_chip_t* chip);
+
+/**
+* @brief Disconnects every chip model
+*/
+void sn54hc595_host_detach_all(void);
+
+/**
+* @brief Adds a pin to the VCD trace, before sn54hc595_host_trace_open
+*
+* @return 0 on success, -1 if SN54HC595_HOST_TRACE_PINS are traced
+*/
+int8_t sn54hc595_host_trace_pin(GPIO_TypeDef* port, uint16_t pin,
+		const char* name);
+
+/**
+* @brief Starts writing the traced pins and the chips' storage registers
+* to a VCD file, 1ns timescale
+*
+* @return 0 on success, -1 if the file could not be opened
+*/
+int8_t sn54hc595_host_trace_open(const char* path);
+
+/**
+* @brief Ends the VCD file and forgets the traced pins
+*/
+void sn54hc595_host_trace_close(void);
+
+/**
+* @brief Sum of the timing violations of every attached chip
+*/
+uint32_t sn54hc595_host_violations(void);
+
+#endif /* SN54HC595_HOST_H_ */
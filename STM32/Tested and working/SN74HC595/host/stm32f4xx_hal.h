@@ -0,0 +1,140 @@
+/**
+ * @file stm32f4xx_hal.h
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @copyright GNU GPL v3
+ * @brief   Minimal STM32 HAL replacement for building the SN54HC595 library
+ *          on a host machine
+ *	
+ *	Put this directory in front of the real HAL on the include path. GPIO
+ *	writes made through HAL_GPIO_WritePin and through the BSRR stores of
+ *	SN54HC595_fast.h then land in the port model of sn54hc595_host.c,
+ *	which counts them.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef SN54HC595_HOST_HAL_H_
+#define SN54HC595_HOST_HAL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum
+{
+	HAL_OK       = 0x00U,
+	HAL_ERROR    = 0x01U,
+	HAL_BUSY     = 0x02U,
+	HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef struct {
+	uint32_t ODR;		/*!< Output levels */
+	uint32_t BSRR;		/*!< Last mask stored, for inspection only */
+} GPIO_TypeDef;
+
+typedef struct {
+	uint32_t Pin;
+	uint32_t Mode;
+	uint32_t Pull;
+	uint32_t Speed;
+} GPIO_InitTypeDef;
+
+typedef enum {
+	GPIO_PIN_RESET = 0,
+	GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct {
+	uint32_t CNT;
+	uint32_t ARR;
+} TIM_TypeDef;
+
+typedef struct {
+	TIM_TypeDef* Instance;
+} TIM_HandleTypeDef;
+
+#define __HAL_TIM_SET_AUTORELOAD(__HANDLE__, __AUTORELOAD__) \
+	((__HANDLE__)->Instance->ARR = (__AUTORELOAD__))
+
+#define SN54HC595_HOST_PORTS	7
+
+extern GPIO_TypeDef sn54hc595_host_ports[SN54HC595_HOST_PORTS];
+
+#define GPIOA	(&sn54hc595_host_ports[0])
+#define GPIOB	(&sn54hc595_host_ports[1])
+#define GPIOC	(&sn54hc595_host_ports[2])
+#define GPIOD	(&sn54hc595_host_ports[3])
+#define GPIOE	(&sn54hc595_host_ports[4])
+#define GPIOF	(&sn54hc595_host_ports[5])
+#define GPIOG	(&sn54hc595_host_ports[6])
+
+#define GPIO_PIN_0		((uint16_t)0x0001)
+#define GPIO_PIN_1		((uint16_t)0x0002)
+#define GPIO_PIN_2		((uint16_t)0x0004)
+#define GPIO_PIN_3		((uint16_t)0x0008)
+#define GPIO_PIN_4		((uint16_t)0x0010)
+#define GPIO_PIN_5		((uint16_t)0x0020)
+#define GPIO_PIN_6		((uint16_t)0x0040)
+#define GPIO_PIN_7		((uint16_t)0x0080)
+#define GPIO_PIN_8		((uint16_t)0x0100)
+#define GPIO_PIN_9		((uint16_t)0x0200)
+#define GPIO_PIN_10		((uint16_t)0x0400)
+#define GPIO_PIN_11		((uint16_t)0x0800)
+#define GPIO_PIN_12		((uint16_t)0x1000)
+#define GPIO_PIN_13		((uint16_t)0x2000)
+#define GPIO_PIN_14		((uint16_t)0x4000)
+#define GPIO_PIN_15		((uint16_t)0x8000)
+
+#define GPIO_MODE_OUTPUT_PP		0x01U
+#define GPIO_NOPULL				0x00U
+#define GPIO_SPEED_FREQ_LOW		0x00U
+#define GPIO_SPEED_FREQ_HIGH	0x02U
+
+#define __HAL_RCC_GPIOA_CLK_ENABLE()	do{}while(0)
+#define __HAL_RCC_GPIOB_CLK_ENABLE()	do{}while(0)
+#define __HAL_RCC_GPIOC_CLK_ENABLE()	do{}while(0)
+#define __HAL_RCC_GPIOD_CLK_ENABLE()	do{}while(0)
+#define __HAL_RCC_GPIOE_CLK_ENABLE()	do{}while(0)
+#define __HAL_RCC_GPIOF_CLK_ENABLE()	do{}while(0)
+#define __HAL_RCC_GPIOG_CLK_ENABLE()	do{}while(0)
+
+//no interrupts on the host
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t priMask) { (void)priMask; }
+static inline void __disable_irq(void) {}
+
+void sn54hc595_host_bsrr(GPIO_TypeDef* port, uint32_t mask);
+void sn54hc595_host_nop(void);
+
+//a NOP moves the simulated time on by a cycle
+#define __NOP()		sn54hc595_host_nop()
+
+//BSRR stores of SN54HC595_fast.h go to the port model
+#define SN54HC595_BSRR_WRITE(PORT, MASK)	sn54hc595_host_bsrr((PORT), (MASK))
+
+void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init);
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin,
+		GPIO_PinState PinState);
+void HAL_Delay(uint32_t Delay);
+uint32_t HAL_GetTick(void);
+
+#endif /* SN54HC595_HOST_HAL_H_ */
@@ -0,0 +1,1178 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Bit-packed proportional fonts for the SSD1306 library
+ *
+ * Glyph data is converted from the fixed width fonts in fonts.c
+ * (Copyright (c) 2016 Olivier Van den Eede - ovde.be, MIT licence).
+ *
+ * Glyph table entries are {offset, width, advance, y_offset, rows}.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stddef.h>
+
+#include "fonts_packed.h"
+
+int8_t packed_font_kerning(const PackedFontDef* font, char first, char second)
+{
+	uint16_t key = ((uint8_t)first << 8) | (uint8_t)second;
+	uint16_t low = 0, high = font->kerning_count, mid, mid_key;
+
+	//binary search, the pairs are sorted
+	while(low < high){
+		mid = (low + high) / 2;
+		mid_key = ((uint8_t)font->kerning[mid].first << 8) |
+				(uint8_t)font->kerning[mid].second;
+		if(mid_key == key)
+			return font->kerning[mid].adjust;
+		if(mid_key < key)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	return 0;
+}
+
+static const uint8_t PackedFont7x10_data [] = {
+// sp
+// !
+0xBF,
+// "
+0xC7, 0x01,
+// #
+0xF4, 0x2F, 0x24, 0xF4, 0x2F,
+// $
+0x66, 0x12, 0xFD, 0x4F, 0x24, 0x07,
+// %
+0x26, 0x19, 0x6E, 0x94, 0x62,
+// &
+0x60, 0x96, 0x99, 0x66, 0x90,
+// '
+0x07,
+// (
+0xFC, 0x08, 0x14, 0x20,
+// )
+0x01, 0x0A, 0xC4, 0x0F,
+// *
+0x7A, 0x0A,
+// +
+0x84, 0x7C, 0x42, 0x00,
+// ,
+0x07,
+// -
+0x07,
+// .
+0x01,
+// /
+0xC0, 0x3C, 0x03,
+// 0
+0x7E, 0x81, 0x89, 0x81, 0x7E,
+// 1
+0x04, 0x02, 0xFF,
+// 2
+0x86, 0xC1, 0xA1, 0x91, 0x8E,
+// 3
+0x42, 0x81, 0x89, 0x89, 0x76,
+// 4
+0x30, 0x2C, 0x22, 0xFF, 0x20,
+// 5
+0x4F, 0x89, 0x89, 0x89, 0x71,
+// 6
+0x7E, 0x89, 0x89, 0x89, 0x72,
+// 7
+0x01, 0xE1, 0x19, 0x05, 0x03,
+// 8
+0x76, 0x89, 0x89, 0x89, 0x76,
+// 9
+0x4E, 0x91, 0x91, 0x91, 0x7E,
+// :
+0x21,
+// ;
+0x71,
+// <
+0x44, 0xA9, 0x18, 0x01,
+// =
+0x6D, 0x5B,
+// >
+0x31, 0x2A, 0x45, 0x00,
+// ?
+0x02, 0x01, 0xB1, 0x09, 0x06,
+// @
+0x7E, 0x81, 0x99, 0x95, 0x1E,
+// A
+0xE0, 0x3E, 0x21, 0x3E, 0xE0,
+// B
+0xFF, 0x89, 0x89, 0x89, 0x76,
+// C
+0x7E, 0x81, 0x81, 0x81, 0x42,
+// D
+0xFF, 0x81, 0x81, 0x42, 0x3C,
+// E
+0xFF, 0x89, 0x89, 0x89, 0x89,
+// F
+0xFF, 0x09, 0x09, 0x09, 0x01,
+// G
+0x7E, 0x81, 0x91, 0x91, 0x72,
+// H
+0xFF, 0x08, 0x08, 0x08, 0xFF,
+// I
+0x81, 0xFF, 0x81,
+// J
+0x40, 0x80, 0x80, 0x80, 0x7F,
+// K
+0xFF, 0x08, 0x14, 0x62, 0x81,
+// L
+0xFF, 0x80, 0x80, 0x80, 0x80,
+// M
+0xFF, 0x06, 0x08, 0x06, 0xFF,
+// N
+0xFF, 0x06, 0x18, 0x60, 0xFF,
+// O
+0x7E, 0x81, 0x81, 0x81, 0x7E,
+// P
+0xFF, 0x11, 0x11, 0x11, 0x0E,
+// Q
+0x7E, 0x02, 0x05, 0x0B, 0xE4, 0x17,
+// R
+0xFF, 0x11, 0x11, 0x71, 0x8E,
+// S
+0x46, 0x89, 0x89, 0x91, 0x62,
+// T
+0x01, 0x01, 0xFF, 0x01, 0x01,
+// U
+0x7F, 0x80, 0x80, 0x80, 0x7F,
+// V
+0x07, 0x38, 0xC0, 0x38, 0x07,
+// W
+0x3F, 0xE0, 0x1C, 0xE0, 0x3F,
+// X
+0x81, 0x66, 0x18, 0x66, 0x81,
+// Y
+0x03, 0x0C, 0xF0, 0x0C, 0x03,
+// Z
+0xC1, 0xA1, 0x99, 0x85, 0x83,
+// [
+0xFF, 0x07, 0x08,
+// backslash
+0x03, 0x3C, 0xC0,
+// ]
+0x01, 0xFE, 0x0F,
+// ^
+0x68, 0x61, 0x08,
+// _
+0x7F,
+// `
+0x09,
+// a
+0x5A, 0x59, 0x56, 0x3E,
+// b
+0xFF, 0x48, 0x84, 0x84, 0x78,
+// c
+0x5E, 0x18, 0x86, 0x12,
+// d
+0x78, 0x84, 0x84, 0x48, 0xFF,
+// e
+0x5E, 0x59, 0x96, 0x16,
+// f
+0x04, 0x04, 0xFE, 0x05, 0x05,
+// g
+0x9E, 0xA1, 0xA1, 0x92, 0x7F,
+// h
+0xFF, 0x08, 0x04, 0x04, 0xF8,
+// i
+0x04, 0x04, 0xFD,
+// j
+0x00, 0x12, 0x48, 0x60, 0x7F,
+// k
+0xFF, 0x10, 0x28, 0x44, 0x80,
+// l
+0x01, 0x01, 0xFF,
+// m
+0x7F, 0xF0, 0x07, 0x3E,
+// n
+0xBF, 0x10, 0x04, 0x3E,
+// o
+0x5E, 0x18, 0x86, 0x1E,
+// p
+0xFF, 0x12, 0x21, 0x21, 0x1E,
+// q
+0x1E, 0x21, 0x21, 0x12, 0xFF,
+// r
+0xBF, 0x10, 0x04, 0x02,
+// s
+0x52, 0x59, 0xA6, 0x12,
+// t
+0x04, 0x7F, 0x84, 0x84,
+// u
+0x1F, 0x08, 0x42, 0x3F,
+// v
+0x03, 0x07, 0x72, 0x03,
+// w
+0x0F, 0x7E, 0xE0, 0x0F,
+// x
+0xA1, 0xC4, 0x48, 0x21,
+// y
+0x83, 0x8C, 0x70, 0x0C, 0x03,
+// z
+0x71, 0x5A, 0x8E, 0x21,
+// {
+0x30, 0x3C, 0x1F, 0x20,
+// |
+0xFF, 0x03,
+// }
+0x01, 0x3E, 0x0F, 0x03,
+// ~
+0x97, 0x03,
+};
+
+static const PackedGlyph PackedFont7x10_glyphs [] = {
+	{0, 0, 3, 0, 0},	// sp
+	{0, 1, 2, 0, 8},	// !
+	{1, 3, 4, 0, 3},	// "
+	{3, 5, 6, 0, 8},	// #
+	{8, 5, 6, 0, 9},	// $
+	{14, 5, 6, 0, 8},	// %
+	{19, 5, 6, 0, 8},	// &
+	{24, 1, 2, 0, 3},	// '
+	{25, 3, 4, 0, 10},	// (
+	{29, 3, 4, 0, 10},	// )
+	{33, 3, 4, 0, 4},	// *
+	{35, 5, 6, 2, 5},	// +
+	{39, 1, 2, 7, 3},	// ,
+	{40, 3, 4, 5, 1},	// -
+	{41, 1, 2, 7, 1},	// .
+	{42, 3, 4, 0, 8},	// /
+	{45, 5, 6, 0, 8},	// 0
+	{50, 3, 4, 0, 8},	// 1
+	{53, 5, 6, 0, 8},	// 2
+	{58, 5, 6, 0, 8},	// 3
+	{63, 5, 6, 0, 8},	// 4
+	{68, 5, 6, 0, 8},	// 5
+	{73, 5, 6, 0, 8},	// 6
+	{78, 5, 6, 0, 8},	// 7
+	{83, 5, 6, 0, 8},	// 8
+	{88, 5, 6, 0, 8},	// 9
+	{93, 1, 2, 2, 6},	// :
+	{94, 1, 2, 3, 7},	// ;
+	{95, 5, 6, 2, 5},	// <
+	{99, 5, 6, 3, 3},	// =
+	{101, 5, 6, 2, 5},	// >
+	{105, 5, 6, 0, 8},	// ?
+	{110, 5, 6, 0, 8},	// @
+	{115, 5, 6, 0, 8},	// A
+	{120, 5, 6, 0, 8},	// B
+	{125, 5, 6, 0, 8},	// C
+	{130, 5, 6, 0, 8},	// D
+	{135, 5, 6, 0, 8},	// E
+	{140, 5, 6, 0, 8},	// F
+	{145, 5, 6, 0, 8},	// G
+	{150, 5, 6, 0, 8},	// H
+	{155, 3, 4, 0, 8},	// I
+	{158, 5, 6, 0, 8},	// J
+	{163, 5, 6, 0, 8},	// K
+	{168, 5, 6, 0, 8},	// L
+	{173, 5, 6, 0, 8},	// M
+	{178, 5, 6, 0, 8},	// N
+	{183, 5, 6, 0, 8},	// O
+	{188, 5, 6, 0, 8},	// P
+	{193, 5, 6, 0, 9},	// Q
+	{199, 5, 6, 0, 8},	// R
+	{204, 5, 6, 0, 8},	// S
+	{209, 5, 6, 0, 8},	// T
+	{214, 5, 6, 0, 8},	// U
+	{219, 5, 6, 0, 8},	// V
+	{224, 5, 6, 0, 8},	// W
+	{229, 5, 6, 0, 8},	// X
+	{234, 5, 6, 0, 8},	// Y
+	{239, 5, 6, 0, 8},	// Z
+	{244, 2, 3, 0, 10},	// [
+	{247, 3, 4, 0, 8},	// backslash
+	{250, 2, 3, 0, 10},	// ]
+	{253, 5, 6, 0, 4},	// ^
+	{256, 7, 8, 9, 1},	// _
+	{257, 2, 3, 0, 2},	// `
+	{258, 5, 6, 2, 6},	// a
+	{262, 5, 6, 0, 8},	// b
+	{267, 5, 6, 2, 6},	// c
+	{271, 5, 6, 0, 8},	// d
+	{276, 5, 6, 2, 6},	// e
+	{280, 5, 6, 0, 8},	// f
+	{285, 5, 6, 2, 8},	// g
+	{290, 5, 6, 0, 8},	// h
+	{295, 3, 4, 0, 8},	// i
+	{298, 4, 5, 0, 10},	// j
+	{303, 5, 6, 0, 8},	// k
+	{308, 3, 4, 0, 8},	// l
+	{311, 5, 6, 2, 6},	// m
+	{315, 5, 6, 2, 6},	// n
+	{319, 5, 6, 2, 6},	// o
+	{323, 5, 6, 2, 8},	// p
+	{328, 5, 6, 2, 8},	// q
+	{333, 5, 6, 2, 6},	// r
+	{337, 5, 6, 2, 6},	// s
+	{341, 4, 5, 0, 8},	// t
+	{345, 5, 6, 2, 6},	// u
+	{349, 5, 6, 2, 6},	// v
+	{353, 5, 6, 2, 6},	// w
+	{357, 5, 6, 2, 6},	// x
+	{361, 5, 6, 2, 8},	// y
+	{366, 5, 6, 2, 6},	// z
+	{370, 3, 4, 0, 10},	// {
+	{374, 1, 2, 0, 10},	// |
+	{376, 3, 4, 0, 10},	// }
+	{380, 5, 6, 3, 2},	// ~
+};
+
+static const PackedKernPair PackedFont7x10_kerning [] = {
+	{'A', '1', -1}, {'A', '7', -1}, {'A', 'T', -1}, {'A', 'V', -1},
+	{'A', 'Y', -1}, {'A', 'f', -1}, {'A', 'i', -1}, {'A', 'j', -1},
+	{'A', 'l', -1}, {'A', 't', -1}, {'A', 'v', -1}, {'A', 'y', -1},
+	{'F', ',', -1}, {'F', '.', -1}, {'F', '1', -1}, {'F', '4', -1},
+	{'F', 'A', -1}, {'F', 'J', -1}, {'F', 'a', -1}, {'F', 'c', -1},
+	{'F', 'd', -1}, {'F', 'e', -1}, {'F', 'f', -1}, {'F', 'g', -1},
+	{'F', 'i', -1}, {'F', 'j', -1}, {'F', 'm', -1}, {'F', 'n', -1},
+	{'F', 'o', -1}, {'F', 'p', -1}, {'F', 'q', -1}, {'F', 'r', -1},
+	{'F', 's', -1}, {'F', 't', -1}, {'F', 'u', -1}, {'F', 'v', -1},
+	{'F', 'w', -1}, {'F', 'x', -1}, {'F', 'y', -1}, {'F', 'z', -1},
+	{'L', '1', -1}, {'L', '4', -1}, {'L', '7', -1}, {'L', 'T', -1},
+	{'L', 'V', -1}, {'L', 'W', -1}, {'L', 'Y', -1}, {'L', 'f', -1},
+	{'L', 'i', -1}, {'L', 'j', -1}, {'L', 'l', -1}, {'L', 't', -1},
+	{'L', 'v', -1}, {'L', 'w', -1}, {'L', 'y', -1}, {'P', ',', -1},
+	{'P', '.', -1}, {'P', 'A', -1}, {'P', 'J', -1}, {'P', 'j', -1},
+	{'T', ',', -1}, {'T', '.', -1}, {'T', '1', -1}, {'T', '4', -1},
+	{'T', 'A', -1}, {'T', 'J', -1}, {'T', 'a', -1}, {'T', 'c', -1},
+	{'T', 'd', -1}, {'T', 'e', -1}, {'T', 'f', -1}, {'T', 'g', -1},
+	{'T', 'i', -1}, {'T', 'j', -1}, {'T', 'm', -1}, {'T', 'n', -1},
+	{'T', 'o', -1}, {'T', 'p', -1}, {'T', 'q', -1}, {'T', 'r', -1},
+	{'T', 's', -1}, {'T', 't', -1}, {'T', 'u', -1}, {'T', 'v', -1},
+	{'T', 'w', -1}, {'T', 'x', -1}, {'T', 'y', -1}, {'T', 'z', -1},
+	{'V', ',', -1}, {'V', '.', -1}, {'V', '4', -1}, {'V', 'A', -1},
+	{'V', 'J', -1}, {'V', 'j', -1}, {'W', ',', -1}, {'W', '.', -1},
+	{'W', 'j', -1}, {'Y', ',', -1}, {'Y', '.', -1}, {'Y', '4', -1},
+	{'Y', 'A', -1}, {'Y', 'J', -1}, {'Y', 'a', -1}, {'Y', 'c', -1},
+	{'Y', 'd', -1}, {'Y', 'e', -1}, {'Y', 'g', -1}, {'Y', 'j', -1},
+	{'Y', 'o', -1}, {'Y', 'q', -1}, {'Y', 's', -1}, {'f', ',', -1},
+	{'f', '.', -1}, {'f', '4', -1}, {'f', 'A', -1}, {'f', 'J', -1},
+	{'f', 'j', -1}, {'r', ',', -1}, {'r', '.', -1}, {'r', '3', -1},
+	{'r', '7', -1}, {'r', 'A', -1}, {'r', 'I', -1}, {'r', 'J', -1},
+	{'r', 'T', -1}, {'r', 'X', -1}, {'r', 'Y', -1}, {'r', 'Z', -1},
+	{'r', 'j', -1}, {'r', 'l', -1},
+};
+
+PackedFontDef PackedFont_7x10 = {10, ' ', '~',
+		PackedFont7x10_glyphs, PackedFont7x10_data,
+		PackedFont7x10_kerning,
+		sizeof(PackedFont7x10_kerning) / sizeof(PackedFont7x10_kerning[0])};
+
+static const uint8_t PackedFont11x18_data [] = {
+// sp
+// !
+0xFF, 0xF7, 0xFF, 0x0D,
+// "
+0xFF, 0x83, 0xFF, 0x01,
+// #
+0x30, 0x03, 0xEC, 0xFF, 0xFF, 0xFF, 0x0D, 0x30, 0x03, 0xEC, 0xFF, 0xFF, 0xFF, 0x0D, 0x30, 0x03,
+// $
+0x1C, 0x0E, 0x3E, 0x1E, 0x77, 0x38, 0x63, 0x30, 0xFF, 0xFF, 0xC3, 0x30, 0x8E, 0x1F, 0x0C, 0x0F,
+// %
+0x1E, 0xC0, 0x0F, 0x13, 0x62, 0xFC, 0x0C, 0x9E, 0x01, 0xB0, 0x07, 0xF6, 0xC3, 0x84, 0x18, 0x3F,
+0x83, 0x07,
+// &
+0x00, 0x8F, 0xE7, 0xF7, 0x0B, 0x8F, 0xC3, 0xE3, 0xF1, 0xCF, 0xE6, 0xE1, 0x00, 0xFE, 0x80, 0x11,
+// '
+0xFF, 0x03,
+// (
+0xC0, 0x0F, 0xE0, 0xFF, 0xC1, 0x01, 0x8E, 0x01, 0x60, 0x01, 0x00, 0x02,
+// )
+0x01, 0x00, 0x1A, 0x00, 0xC6, 0x01, 0x0E, 0xFE, 0x1F, 0xC0, 0x0F, 0x00,
+// *
+0x96, 0xBF, 0xC7, 0x2D,
+// +
+0x30, 0xC0, 0x00, 0x03, 0x0C, 0xFF, 0xFF, 0x0F, 0x03, 0x0C, 0x30, 0xC0, 0x00,
+// ,
+0xF3, 0x01,
+// -
+0xFF,
+// .
+0x0F,
+// /
+0x00, 0x38, 0xE0, 0x8F, 0x7F, 0xFC, 0x01, 0x07, 0x00,
+// 0
+0xF8, 0x87, 0xFF, 0x77, 0x80, 0x0F, 0xC3, 0xC3, 0xF0, 0x01, 0xEE, 0xFF, 0xE1, 0x1F,
+// 1
+0x18, 0x00, 0x03, 0x60, 0x00, 0xFC, 0xFF, 0xFF, 0x3F,
+// 2
+0x1C, 0xB8, 0x07, 0x7F, 0x60, 0x0F, 0xCC, 0x83, 0xF1, 0x31, 0xEC, 0x07, 0xF3, 0xC0,
+// 3
+0x0C, 0x8C, 0x03, 0x37, 0x80, 0x8F, 0xC1, 0x63, 0xB0, 0x3F, 0xCE, 0xF9, 0x01, 0x3C,
+// 4
+0x00, 0x07, 0xF0, 0x81, 0x6F, 0x78, 0x18, 0xFF, 0xFF, 0xFF, 0x0F, 0x60, 0x00, 0x18,
+// 5
+0xFF, 0xCC, 0x3F, 0x37, 0x84, 0x8F, 0xC1, 0x63, 0xF0, 0x38, 0x3E, 0xFC, 0x01, 0x3E,
+// 6
+0xF8, 0x87, 0xFF, 0x77, 0x8C, 0x8F, 0xC1, 0x63, 0xF0, 0x39, 0xEE, 0xFC, 0x31, 0x3E,
+// 7
+0x03, 0xC0, 0x00, 0x30, 0x80, 0x0F, 0xFE, 0xE3, 0xC3, 0x1E, 0xF0, 0x01, 0x1C, 0x00,
+// 8
+0x1C, 0x8F, 0xEF, 0x37, 0x0C, 0x0F, 0xC3, 0xC3, 0xF0, 0x31, 0xEC, 0xFB, 0x71, 0x3C,
+// 9
+0x7C, 0x8C, 0x3F, 0x77, 0x9C, 0x0F, 0xC6, 0x83, 0xF1, 0x31, 0xEE, 0xFF, 0xE1, 0x1F,
+// :
+0x03, 0x0F, 0x0C,
+// ;
+0x83, 0x39, 0x78,
+// <
+0x10, 0x70, 0xA0, 0x60, 0x43, 0xC4, 0x98, 0xA0, 0xC1,
+// =
+0xF3, 0x3C, 0xCF, 0xF3, 0x3C, 0xCF,
+// >
+0x83, 0x05, 0x19, 0x23, 0xC2, 0x06, 0x05, 0x0E, 0x08,
+// ?
+0x0C, 0x80, 0x03, 0x70, 0x00, 0x0C, 0xDC, 0x83, 0xF7, 0x70, 0x70, 0x0E, 0xF8, 0x01, 0x3C, 0x00,
+// @
+0xF8, 0x87, 0xFF, 0xF7, 0x80, 0x8F, 0xC7, 0xE3, 0xF3, 0xCC, 0xE6, 0x3F, 0xF0, 0x0F,
+// A
+0x00, 0x38, 0xF0, 0xCF, 0x7F, 0xFC, 0x0C, 0x03, 0xC3, 0xCF, 0xC0, 0x7F, 0x00, 0xFF, 0x00, 0x38,
+// B
+0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x0F, 0xC3, 0xC3, 0xB0, 0x7F, 0xCE, 0xF3, 0x01, 0x38,
+// C
+0xF8, 0x87, 0xFF, 0x77, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xEC, 0xC0, 0x31, 0x30,
+// D
+0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xB0, 0x03, 0xE7, 0xFF, 0xE0, 0x0F,
+// E
+0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x0F, 0xC3, 0xC3, 0xF0, 0x30, 0x3C, 0x0C, 0x0F, 0xC0,
+// F
+0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x0C, 0x03, 0xC3, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x00,
+// G
+0xF8, 0x87, 0xFF, 0x77, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x60, 0xEC, 0xF8, 0x31, 0x7E,
+// H
+0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x30, 0xF0, 0xFF, 0xFF, 0xFF,
+// I
+0x03, 0xF0, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0x00, 0x0C,
+// J
+0x00, 0x0E, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x30, 0x00, 0xFE, 0xFF, 0xFD, 0x3F,
+// K
+0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x80, 0x03, 0xB8, 0x03, 0xC7, 0x61, 0xC0, 0x0D, 0xE0, 0x01, 0x20,
+// L
+0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0xC0,
+// M
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x01, 0xC0, 0x00, 0x1F, 0x70, 0x00, 0xFC, 0xFF, 0xFF, 0x3F,
+// N
+0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF0, 0x03, 0xE0, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+// O
+0xF8, 0x87, 0xFF, 0x77, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xEE, 0xFF, 0xE1, 0x1F,
+// P
+0xFF, 0xFF, 0xFF, 0x3F, 0x18, 0x0C, 0x06, 0x83, 0xC1, 0x71, 0xE0, 0x0F, 0xF0, 0x01,
+// Q
+0xF8, 0x87, 0xFF, 0x77, 0x80, 0x0F, 0xC0, 0x03, 0xF6, 0x01, 0xEF, 0xFF, 0xE1, 0x5F, 0x00, 0x20,
+// R
+0xFF, 0xFF, 0xFF, 0x3F, 0x0C, 0x0C, 0x03, 0xC3, 0xC1, 0xF9, 0xE1, 0xE7, 0xF1, 0xE0, 0x00, 0x20,
+// S
+0x00, 0x06, 0x8F, 0xE7, 0x87, 0x8F, 0xC1, 0xC3, 0xF0, 0x70, 0xEC, 0xF8, 0x31, 0x3C,
+// T
+0x03, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x0C, 0x00, 0x03, 0xC0,
+0x00, 0x00,
+// U
+0xFF, 0xCF, 0xFF, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x30, 0x00, 0xFE, 0xFF, 0xFD, 0x3F,
+// V
+0x07, 0xC0, 0x0F, 0x80, 0x3F, 0x00, 0x7F, 0x00, 0x3C, 0xF0, 0x87, 0x3F, 0xFC, 0x00, 0x07, 0x00,
+// W
+0x3F, 0xC0, 0xFF, 0x0F, 0x80, 0x03, 0x3C, 0xE0, 0x01, 0x78, 0x00, 0xF0, 0x00, 0xE0, 0xFF, 0xFF,
+0x0F, 0x00,
+// X
+0x01, 0xE0, 0x01, 0xEE, 0xC1, 0xE1, 0x3C, 0xF0, 0x07, 0xF8, 0x80, 0x73, 0x70, 0x78, 0x07, 0x78,
+0x00, 0x08,
+// Y
+0x01, 0xC0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x3F, 0xF8, 0x8F, 0x07, 0x78, 0x00, 0x07, 0x40,
+0x00, 0x00,
+// Z
+0x00, 0xF8, 0x00, 0x3F, 0x70, 0x0F, 0xCF, 0xE3, 0xF0, 0x0E, 0xFC, 0x01, 0x1F, 0xC0,
+// [
+0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF0, 0x00, 0xC0,
+// backslash
+0x07, 0xC0, 0x1F, 0x80, 0x7F, 0x00, 0xFE, 0x00, 0x38,
+// ]
+0x03, 0x00, 0x0F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+// ^
+0xC0, 0xF0, 0x3C, 0x07, 0x07, 0x3C, 0xF0, 0xC0,
+// _
+0xFF, 0x07,
+// `
+0xD9, 0x09,
+// a
+0xC4, 0x99, 0x3F, 0xF3, 0xCC, 0x33, 0xCD, 0xF6, 0x9F, 0xFF, 0x00, 0x02,
+// b
+0xFF, 0xFF, 0xFF, 0x0F, 0x86, 0xC1, 0xC0, 0x30, 0x30, 0x1C, 0x0E, 0xFE, 0x01, 0x3F,
+// c
+0xFC, 0xF8, 0x77, 0xF8, 0xC0, 0x03, 0x1F, 0xEE, 0x1C, 0x33,
+// d
+0xC0, 0x0F, 0xF8, 0x07, 0x87, 0xC3, 0xC0, 0x30, 0x30, 0x18, 0xF6, 0xFF, 0xFF, 0xFF,
+// e
+0xFC, 0xF8, 0x77, 0xFB, 0xCC, 0x33, 0xDF, 0xEC, 0x1B, 0x2E,
+// f
+0x30, 0x00, 0x0C, 0x00, 0x03, 0xF8, 0xFF, 0xFF, 0xFF, 0x0C, 0x30, 0x03, 0xCC, 0x00, 0x03, 0x00,
+// g
+0xFC, 0x98, 0x7F, 0x7E, 0x38, 0x0F, 0xCC, 0x03, 0xB3, 0x61, 0xFE, 0xFF, 0xFD, 0x3F,
+// h
+0xFF, 0xFF, 0xFF, 0x0F, 0x06, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0xFF, 0x83, 0xFF,
+// i
+0x30, 0x00, 0x0C, 0x00, 0x03, 0xCC, 0xFF, 0xF3, 0x3F,
+// j
+0x00, 0x80, 0xC1, 0x00, 0x0C, 0x03, 0x30, 0x0C, 0xC0, 0xF3, 0xFF, 0xCF, 0xFF, 0x07,
+// k
+0xFF, 0xFF, 0xFF, 0x0F, 0x30, 0x00, 0x06, 0xC0, 0x03, 0x98, 0x03, 0xC3, 0x41, 0xC0, 0x00, 0x20,
+// l
+0x03, 0xC0, 0x00, 0x30, 0x00, 0xFC, 0xFF, 0xFF, 0x3F,
+// m
+0xFF, 0xFF, 0x2F, 0xC0, 0x00, 0xFF, 0xFF, 0x6F, 0xC0, 0x00, 0xFF, 0xFB, 0x0F,
+// n
+0xFF, 0xFF, 0x6F, 0xC0, 0x00, 0x03, 0x0C, 0xF0, 0xBF, 0xFF,
+// o
+0xFC, 0xF8, 0x77, 0xF8, 0xC0, 0x03, 0x1F, 0xEE, 0x1F, 0x3F,
+// p
+0xFF, 0xFF, 0xFF, 0x6F, 0x18, 0x0C, 0x0C, 0x03, 0xC3, 0xE1, 0xE0, 0x1F, 0xF0, 0x03,
+// q
+0xFC, 0x80, 0x7F, 0x70, 0x38, 0x0C, 0x0C, 0x03, 0x83, 0x61, 0xF0, 0xFF, 0xFF, 0xFF,
+// r
+0x01, 0xFC, 0xEF, 0xBF, 0x01, 0x03, 0x0C, 0x70, 0x80, 0x00,
+// s
+0x9C, 0xF9, 0x36, 0xF3, 0xCC, 0x33, 0xCF, 0x6C, 0x9F, 0x39,
+// t
+0x18, 0x00, 0x03, 0xF8, 0xBF, 0xFF, 0x8F, 0x81, 0x31, 0x30, 0x06, 0x06, 0xC0,
+// u
+0xFF, 0xFD, 0x0F, 0x30, 0xC0, 0x00, 0x03, 0xF6, 0xFF, 0xFF,
+// v
+0x01, 0x3C, 0xE0, 0x07, 0x7C, 0x80, 0xC3, 0xEF, 0xC7, 0x03, 0x01, 0x00,
+// w
+0x07, 0xFC, 0x03, 0xFC, 0x3F, 0x07, 0xFC, 0x03, 0xFC, 0x3F, 0x07, 0x00,
+// x
+0x01, 0x1E, 0xEE, 0x1C, 0x1E, 0x78, 0x38, 0x77, 0x78, 0x80,
+// y
+0x03, 0xF0, 0x07, 0xCC, 0x8F, 0x83, 0x7F, 0x00, 0x1F, 0xFE, 0xF1, 0x0F, 0x1C, 0x00,
+// z
+0x03, 0x0F, 0x3E, 0xFC, 0xD8, 0x33, 0x6F, 0xFC, 0xF0, 0xC1, 0x03, 0x03,
+// {
+0x00, 0x03, 0x00, 0x1E, 0xE0, 0xFF, 0xDF, 0x3F, 0xFF, 0x03, 0x00, 0x0F, 0x00, 0x0C,
+// |
+0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+// }
+0x03, 0x00, 0x0F, 0x00, 0xFC, 0xCF, 0xBF, 0xFF, 0x7F, 0x80, 0x07, 0x00, 0x0C, 0x00,
+// ~
+0xDE, 0x66, 0x7B,
+};
+
+static const PackedGlyph PackedFont11x18_glyphs [] = {
+	{0, 0, 5, 0, 0},	// sp
+	{0, 2, 3, 1, 14},	// !
+	{4, 5, 6, 1, 5},	// "
+	{8, 9, 10, 1, 14},	// #
+	{24, 8, 9, 1, 16},	// $
+	{40, 10, 11, 1, 14},	// %
+	{58, 9, 10, 1, 14},	// &
+	{74, 2, 3, 1, 5},	// '
+	{76, 5, 6, 0, 18},	// (
+	{88, 5, 6, 0, 18},	// )
+	{100, 6, 7, 1, 5},	// *
+	{104, 10, 11, 3, 10},	// +
+	{117, 2, 3, 13, 5},	// ,
+	{119, 4, 5, 9, 2},	// -
+	{120, 2, 3, 13, 2},	// .
+	{121, 5, 6, 1, 14},	// /
+	{130, 8, 9, 1, 14},	// 0
+	{144, 5, 6, 1, 14},	// 1
+	{153, 8, 9, 1, 14},	// 2
+	{167, 8, 9, 1, 14},	// 3
+	{181, 8, 9, 1, 14},	// 4
+	{195, 8, 9, 1, 14},	// 5
+	{209, 8, 9, 1, 14},	// 6
+	{223, 8, 9, 1, 14},	// 7
+	{237, 8, 9, 1, 14},	// 8
+	{251, 8, 9, 1, 14},	// 9
+	{265, 2, 3, 5, 10},	// :
+	{268, 2, 3, 6, 12},	// ;
+	{271, 8, 9, 4, 9},	// <
+	{280, 8, 9, 5, 6},	// =
+	{286, 8, 9, 4, 9},	// >
+	{295, 9, 10, 1, 14},	// ?
+	{311, 8, 9, 1, 14},	// @
+	{325, 9, 10, 1, 14},	// A
+	{341, 8, 9, 1, 14},	// B
+	{355, 8, 9, 1, 14},	// C
+	{369, 8, 9, 1, 14},	// D
+	{383, 8, 9, 1, 14},	// E
+	{397, 8, 9, 1, 14},	// F
+	{411, 8, 9, 1, 14},	// G
+	{425, 8, 9, 1, 14},	// H
+	{439, 6, 7, 1, 14},	// I
+	{450, 8, 9, 1, 14},	// J
+	{464, 9, 10, 1, 14},	// K
+	{480, 8, 9, 1, 14},	// L
+	{494, 9, 10, 1, 14},	// M
+	{510, 8, 9, 1, 14},	// N
+	{524, 8, 9, 1, 14},	// O
+	{538, 8, 9, 1, 14},	// P
+	{552, 9, 10, 1, 14},	// Q
+	{568, 9, 10, 1, 14},	// R
+	{584, 8, 9, 1, 14},	// S
+	{598, 10, 11, 1, 14},	// T
+	{616, 8, 9, 1, 14},	// U
+	{630, 9, 10, 1, 14},	// V
+	{646, 10, 11, 1, 14},	// W
+	{664, 10, 11, 1, 14},	// X
+	{682, 10, 11, 1, 14},	// Y
+	{700, 8, 9, 1, 14},	// Z
+	{714, 4, 5, 0, 18},	// [
+	{723, 5, 6, 1, 14},	// backslash
+	{732, 4, 5, 0, 18},	// ]
+	{741, 8, 9, 1, 8},	// ^
+	{749, 11, 12, 16, 1},	// _
+	{751, 4, 5, 1, 3},	// `
+	{753, 9, 10, 5, 10},	// a
+	{765, 8, 9, 1, 14},	// b
+	{779, 8, 9, 5, 10},	// c
+	{789, 8, 9, 1, 14},	// d
+	{803, 8, 9, 5, 10},	// e
+	{813, 9, 10, 1, 14},	// f
+	{829, 8, 9, 4, 14},	// g
+	{843, 8, 9, 1, 14},	// h
+	{857, 5, 6, 1, 14},	// i
+	{866, 6, 7, 0, 18},	// j
+	{880, 9, 10, 1, 14},	// k
+	{896, 5, 6, 1, 14},	// l
+	{905, 10, 11, 5, 10},	// m
+	{918, 8, 9, 5, 10},	// n
+	{928, 8, 9, 5, 10},	// o
+	{938, 8, 9, 4, 14},	// p
+	{952, 8, 9, 4, 14},	// q
+	{966, 8, 9, 5, 10},	// r
+	{976, 8, 9, 5, 10},	// s
+	{986, 8, 9, 2, 13},	// t
+	{999, 8, 9, 5, 10},	// u
+	{1009, 9, 10, 5, 10},	// v
+	{1021, 9, 10, 5, 10},	// w
+	{1033, 8, 9, 5, 10},	// x
+	{1043, 8, 9, 4, 14},	// y
+	{1057, 9, 10, 5, 10},	// z
+	{1069, 6, 7, 0, 18},	// {
+	{1083, 2, 3, 0, 18},	// |
+	{1088, 6, 7, 0, 18},	// }
+	{1102, 8, 9, 7, 3},	// ~
+};
+
+static const PackedKernPair PackedFont11x18_kerning [] = {
+	{'A', '1', -2}, {'A', '7', -2}, {'A', 'T', -2}, {'A', 'V', -2},
+	{'A', 'Y', -2}, {'A', 'l', -2}, {'A', 'v', -2}, {'A', 'y', -2},
+	{'F', ',', -2}, {'F', '.', -2}, {'F', 'A', -2}, {'F', 'J', -2},
+	{'F', 'j', -2}, {'F', 'r', -2}, {'F', 'v', -2}, {'F', 'x', -2},
+	{'F', 'y', -2}, {'L', '1', -2}, {'L', '4', -2}, {'L', '7', -2},
+	{'L', 'T', -2}, {'L', 'V', -2}, {'L', 'Y', -2}, {'L', 'f', -2},
+	{'L', 'i', -2}, {'L', 'l', -2}, {'L', 't', -2}, {'L', 'v', -2},
+	{'L', 'y', -2}, {'P', ',', -2}, {'P', '.', -2}, {'P', 'J', -2},
+	{'T', ',', -2}, {'T', '.', -2}, {'T', '4', -2}, {'T', 'A', -2},
+	{'T', 'J', -2}, {'T', 'a', -2}, {'T', 'c', -2}, {'T', 'd', -2},
+	{'T', 'e', -2}, {'T', 'f', -2}, {'T', 'g', -2}, {'T', 'i', -2},
+	{'T', 'j', -2}, {'T', 'm', -2}, {'T', 'n', -2}, {'T', 'o', -2},
+	{'T', 'p', -2}, {'T', 'q', -2}, {'T', 'r', -2}, {'T', 's', -2},
+	{'T', 't', -2}, {'T', 'u', -2}, {'T', 'v', -2}, {'T', 'w', -2},
+	{'T', 'x', -2}, {'T', 'y', -2}, {'T', 'z', -2}, {'V', ',', -2},
+	{'V', '.', -2}, {'V', '4', -2}, {'V', 'A', -2}, {'V', 'J', -2},
+	{'Y', ',', -2}, {'Y', '.', -2}, {'Y', '4', -2}, {'Y', 'A', -2},
+	{'Y', 'J', -2}, {'Y', 'S', -2}, {'Y', 'a', -2}, {'Y', 'c', -2},
+	{'Y', 'd', -2}, {'Y', 'e', -2}, {'Y', 'f', -2}, {'Y', 'g', -2},
+	{'Y', 'i', -2}, {'Y', 'j', -2}, {'Y', 'm', -2}, {'Y', 'n', -2},
+	{'Y', 'o', -2}, {'Y', 'q', -2}, {'Y', 'r', -2}, {'Y', 's', -2},
+	{'Y', 't', -2}, {'Y', 'u', -2}, {'Y', 'v', -2}, {'Y', 'w', -2},
+	{'Y', 'x', -2}, {'Y', 'z', -2}, {'f', ',', -2}, {'f', '.', -2},
+	{'f', '4', -2}, {'f', 'A', -2}, {'f', 'J', -2}, {'f', 'j', -2},
+	{'r', ',', -2}, {'r', '.', -2}, {'r', '7', -2}, {'r', 'I', -2},
+	{'r', 'J', -2}, {'r', 'T', -2}, {'r', 'X', -2}, {'r', 'Y', -2},
+	{'r', 'Z', -2}, {'r', 'l', -2},
+};
+
+PackedFontDef PackedFont_11x18 = {18, ' ', '~',
+		PackedFont11x18_glyphs, PackedFont11x18_data,
+		PackedFont11x18_kerning,
+		sizeof(PackedFont11x18_kerning) / sizeof(PackedFont11x18_kerning[0])};
+
+static const uint8_t PackedFont16x26_data [] = {
+// sp
+// !
+0xFF, 0x03, 0xFC, 0xFF, 0x8F, 0xFF, 0xFF, 0xF1, 0xFF, 0x3F, 0xFE, 0x0F, 0xC0, 0x01,
+// "
+0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x1F,
+// #
+0x00, 0x60, 0x00, 0x10, 0x0C, 0x00, 0x83, 0x71, 0x60, 0xF0, 0x0F, 0xEC, 0xFF, 0xC1, 0xFF, 0x9F,
+0xFF, 0x3F, 0xF8, 0x7F, 0xC3, 0xFF, 0xE0, 0xFF, 0x98, 0xFF, 0x03, 0xFF, 0x7F, 0xFE, 0xFF, 0xF0,
+0xFF, 0x07, 0xFE, 0xC1, 0xC0, 0x33, 0x18, 0x00, 0x06, 0x03,
+// $
+0x00, 0x00, 0x0C, 0x7E, 0x00, 0x86, 0x7F, 0x00, 0xC7, 0x7F, 0x80, 0xF3, 0x7F, 0x80, 0x39, 0xFC,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFE, 0xCF, 0x01, 0xFE, 0xE3,
+0x00, 0xFF, 0x61, 0x00, 0x7F, 0x00,
+// %
+0xFE, 0x01, 0xD8, 0x3F, 0x80, 0xFF, 0x0F, 0xFC, 0x81, 0xC1, 0x17, 0x20, 0x7C, 0x9E, 0xE7, 0xC3,
+0xFF, 0x3E, 0xF0, 0xFF, 0x03, 0xFC, 0xFF, 0x07, 0xF0, 0xFF, 0x81, 0xEF, 0x7F, 0xF8, 0xFC, 0xCF,
+0x8F, 0x81, 0x7D, 0x30, 0xF0, 0x07, 0xFE, 0x3F, 0xC0, 0xFF,
+// &
+0x00, 0xF8, 0x03, 0x80, 0xFF, 0x00, 0xF0, 0x3F, 0x1C, 0xFF, 0xEF, 0xFF, 0xE0, 0xFF, 0x0F, 0xF8,
+0xFF, 0x07, 0xFE, 0xFF, 0xC1, 0x83, 0xFF, 0xF8, 0xBF, 0xBF, 0xFF, 0xC7, 0x7F, 0x7F, 0xF0, 0xE7,
+0x07, 0xF8, 0x01, 0xE0, 0x3F, 0x00, 0xFF, 0x07, 0xE0, 0xEF,
+// '
+0xBF, 0xFF, 0xFF, 0xFF, 0x01,
+// (
+0x00, 0xFF, 0x00, 0xC0, 0xFF, 0x0F, 0xC0, 0xFF, 0x3F, 0xE0, 0xFF, 0xFF, 0xC1, 0x1F, 0xF8, 0xC3,
+0x07, 0x80, 0xCF, 0x03, 0x00, 0xBC, 0x03, 0x00, 0x70, 0x03, 0x00, 0xC0, 0x07, 0x00, 0x80, 0x07,
+0x00, 0x00, 0x0E, 0x00, 0x00, 0x0C,
+// )
+0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xEE,
+0x01, 0x00, 0x9E, 0x0F, 0x00, 0x1F, 0xFE, 0xC0, 0x1F, 0xFC, 0xFF, 0x3F, 0xE0, 0xFF, 0x1F, 0x80,
+0xFF, 0x1F, 0x00, 0xF8, 0x07, 0x00,
+// *
+0x38, 0x80, 0x43, 0x38, 0x06, 0xF3, 0xF3, 0xFF, 0x7F, 0x1F, 0xF1, 0x3B, 0xF1, 0x0F, 0xFB, 0x38,
+0x8F, 0x43, 0x38, 0x00, 0x03,
+// +
+0x80, 0x01, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0xFE, 0xFF, 0xFF,
+0xFF, 0xFF, 0x3F, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03,
+// ,
+0x0F, 0xFF, 0xFF, 0xFF, 0xF7, 0x07,
+// -
+0xFF, 0xFF, 0xFF, 0x03,
+// .
+0xFF, 0xFF, 0x0F,
+// /
+0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x07, 0x00, 0xE0, 0x0F, 0x00, 0xF0, 0x0F,
+0x00, 0xF8, 0x07, 0x00, 0xFC, 0x03, 0x00, 0xFE, 0x01, 0x00, 0xFF, 0x00, 0x80, 0x7F, 0x00, 0xC0,
+0x3F, 0x00, 0xE0, 0x1F, 0x00, 0xF0, 0x0F, 0x00, 0xE0, 0x07, 0x00, 0xC0, 0x03, 0x00, 0x80, 0x01,
+0x00, 0x00,
+// 0
+0xE0, 0xFF, 0x00, 0xFF, 0x7F, 0xF0, 0xFF, 0x1F, 0xFF, 0xFF, 0xF7, 0x07, 0xFC, 0x1F, 0x00, 0xFC,
+0x01, 0x00, 0x1F, 0x00, 0xC0, 0x07, 0x00, 0xFC, 0x01, 0xC0, 0xFF, 0x01, 0x7F, 0xFF, 0xFF, 0xC7,
+0xFF, 0x7F, 0xF0, 0xFF, 0x07, 0xF8, 0x3F, 0x00,
+// 1
+0x0C, 0x00, 0x98, 0x01, 0x00, 0x33, 0x00, 0x60, 0x07, 0x00, 0xEC, 0x00, 0x80, 0xFD, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x60, 0x00, 0x00, 0x0C,
+0x00, 0x80, 0x01, 0x00, 0x30,
+// 2
+0x06, 0x00, 0xDE, 0x00, 0xE0, 0x1F, 0x00, 0xFE, 0x03, 0xF0, 0x3F, 0x00, 0xBF, 0x07, 0xF0, 0xF1,
+0x00, 0x1F, 0x3E, 0xF0, 0xC1, 0xFF, 0x1F, 0xD8, 0xFF, 0x01, 0xFB, 0x1F, 0x60, 0xFE, 0x01, 0x0C,
+0x07, 0x80, 0x01,
+// 3
+0x06, 0x00, 0xFC, 0xC0, 0x80, 0x1F, 0x18, 0xF0, 0x01, 0x03, 0x3C, 0x60, 0x80, 0x07, 0x0E, 0xF0,
+0xC1, 0x03, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xCF, 0xBF, 0xFF, 0xF1, 0xE3, 0x1F, 0x1C, 0xF8, 0x01,
+// 4
+0x00, 0x60, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x01, 0x80, 0x3F, 0x00, 0xF8, 0x07, 0xC0, 0xCF, 0x00,
+0xFC, 0x18, 0xC0, 0x07, 0x03, 0x7E, 0x60, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0x01, 0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x03,
+// 5
+0xFF, 0x03, 0xFC, 0x7F, 0x80, 0xFF, 0x0F, 0xF0, 0xFF, 0x01, 0x7C, 0x30, 0x80, 0x0F, 0x0E, 0xF0,
+0xC1, 0x03, 0x3F, 0xF8, 0xFD, 0x07, 0xFE, 0xEF, 0xC0, 0xFF, 0x1D, 0xF0, 0x1F, 0x00, 0xF8, 0x00,
+// 6
+0x00, 0x0C, 0x00, 0xFC, 0x3F, 0xE0, 0xFF, 0x1F, 0xFE, 0xFF, 0xE7, 0xFF, 0xFF, 0x7C, 0x1C, 0xFE,
+0xC3, 0x01, 0x3F, 0x18, 0xC0, 0x03, 0x03, 0x78, 0xE0, 0x80, 0x0F, 0x3C, 0xF8, 0x83, 0xFF, 0x77,
+0xE0, 0xFF, 0x0C, 0xF8, 0x0F, 0x00, 0xFE, 0x00,
+// 7
+0x07, 0x00, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x03, 0xC0, 0x7F, 0x00, 0xFE, 0x0F, 0xF0, 0xFF,
+0x81, 0xFF, 0x38, 0xF8, 0x03, 0xC7, 0x1F, 0xE0, 0xFE, 0x00, 0xFC, 0x07, 0x80, 0x3F, 0x00, 0xF0,
+0x03, 0x00, 0x1E, 0x00, 0x00,
+// 8
+0x00, 0xC0, 0x01, 0x06, 0xFE, 0xF0, 0xE3, 0x3F, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xFF, 0x3F, 0xF8,
+0xE1, 0x01, 0x1F, 0x78, 0xC0, 0x03, 0x0F, 0xF8, 0xF0, 0x83, 0xFF, 0xFF, 0xF9, 0xFF, 0xFE, 0xE7,
+0x8F, 0xFF, 0xF8, 0xE0, 0x0F, 0x00, 0xF8, 0x00,
+// 9
+0xE0, 0x01, 0x00, 0xFF, 0x80, 0xF1, 0x3F, 0x70, 0xFF, 0x07, 0xFE, 0xFF, 0x81, 0x0F, 0x38, 0xF0,
+0x00, 0x06, 0x1E, 0xC0, 0xE0, 0x07, 0x18, 0xFC, 0x81, 0xE3, 0xFF, 0xBF, 0x3F, 0xFF, 0xFF, 0xC3,
+0xFF, 0x3F, 0xF0, 0xFF, 0x03, 0xF8, 0x0F, 0x00,
+// :
+0x0F, 0xF8, 0x07, 0xFC, 0x03, 0xFE, 0x01, 0xFF, 0x80, 0x07,
+// ;
+0x0F, 0x78, 0xFC, 0x80, 0xFF, 0x0F, 0xF8, 0xFF, 0x80, 0x7F, 0x0F, 0xF8, 0x03,
+// <
+0x80, 0x00, 0x40, 0x00, 0x70, 0x00, 0x38, 0x00, 0x3E, 0x00, 0x1F, 0xC0, 0x1F, 0xE0, 0x0E, 0x38,
+0x0E, 0x1C, 0x07, 0x07, 0x87, 0x83, 0xE3, 0x80, 0x73, 0xC0, 0x1D, 0xC0, 0x0F, 0xE0,
+// =
+0xE3, 0xF1, 0x78, 0x3C, 0x1E, 0x8F, 0xC7, 0xE3, 0xF1, 0x78, 0x3C, 0x1E, 0x8F, 0xC7,
+// >
+0x03, 0xE0, 0x03, 0xF8, 0x01, 0xDC, 0x01, 0xE7, 0x80, 0xE3, 0xE0, 0x70, 0x70, 0x70, 0x1C, 0x38,
+0x0E, 0xB8, 0x03, 0xDC, 0x01, 0x7C, 0x00, 0x3E, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x01,
+// ?
+0x1E, 0x00, 0xE0, 0x03, 0x00, 0x7C, 0x00, 0x80, 0x01, 0x30, 0x3E, 0x80, 0xC7, 0x07, 0xF8, 0xF8,
+0x80, 0x1F, 0x1F, 0xF8, 0xE3, 0x87, 0x07, 0xE0, 0x7F, 0x00, 0xF8, 0x07, 0x00, 0x7F, 0x00, 0xC0,
+0x07, 0x00, 0x30, 0x00, 0x00,
+// @
+0x00, 0x3F, 0x00, 0xFC, 0x3F, 0xE0, 0xFF, 0x0F, 0xFE, 0xFF, 0xE3, 0x07, 0xF8, 0x3C, 0x00, 0xDC,
+0xE3, 0x3F, 0x3F, 0xFE, 0xEF, 0xE3, 0xFF, 0x79, 0x3E, 0x38, 0xCF, 0x01, 0xE7, 0x1B, 0xF8, 0xFE,
+0xE7, 0xCF, 0xFD, 0xFF, 0x9B, 0xFF, 0x7F, 0xC0, 0xFF, 0x0F,
+// A
+0x00, 0x80, 0x03, 0x80, 0x0F, 0xC0, 0x3F, 0xC0, 0xFF, 0xE0, 0x7F, 0xF0, 0x7F, 0xF0, 0xBF, 0xC1,
+0x1F, 0x06, 0x1F, 0x18, 0xFC, 0x63, 0xF0, 0xFF, 0x01, 0xFF, 0x0F, 0xE0, 0xFF, 0x00, 0xFE, 0x0F,
+0xC0, 0x3F, 0x00, 0xFC,
+// B
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x0F, 0x0C, 0x3C, 0x30, 0xF0,
+0xE0, 0xC1, 0xC7, 0x07, 0xFF, 0x7F, 0xFE, 0xEF, 0xBF, 0x3F, 0x7F, 0x7C, 0xFC, 0x01, 0xE0, 0x03,
+// C
+0xE0, 0x1F, 0xE0, 0xFF, 0xC1, 0xFF, 0x0F, 0xFF, 0x3F, 0x3E, 0xF8, 0x39, 0x80, 0x77, 0x00, 0xFC,
+0x01, 0xE0, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x07, 0x00, 0x1F, 0x00, 0x7E,
+0x00, 0x38,
+// D
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+0x00, 0xC0, 0x07, 0x80, 0x1F, 0x00, 0xFE, 0x01, 0x9E, 0xFF, 0x7F, 0xFE, 0xFF, 0xF0, 0xFF, 0x83,
+0xFF, 0x03,
+// E
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x0C, 0x3C, 0x30, 0xF0,
+0xC0, 0xC0, 0x03, 0x03, 0x0F, 0x0C, 0x3C, 0x30, 0xF0, 0xC0, 0xC0, 0x03, 0x03, 0x0F, 0x00, 0x0C,
+// F
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0,
+0xC0, 0x00, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC0, 0x00, 0x03, 0x03, 0x00,
+// G
+0x80, 0x07, 0xC0, 0xFF, 0x80, 0xFF, 0x07, 0xFF, 0x3F, 0xFE, 0xFF, 0xF9, 0xC0, 0xF7, 0x00, 0xFC,
+0x01, 0xE0, 0x07, 0x80, 0x0F, 0x18, 0x3C, 0x60, 0xF0, 0x80, 0xC1, 0x03, 0xFE, 0x1F, 0xF8, 0x7F,
+0xE0, 0xBF, 0x81, 0x7F,
+// H
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x0C, 0x00, 0x30, 0x00,
+0xC0, 0x00, 0x00, 0x03, 0x00, 0x0C, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0x3F,
+// I
+0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x0C,
+// J
+0x00, 0x80, 0x0F, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xF8,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xF7, 0xFF, 0xCF, 0xFF, 0x07,
+// K
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0x80, 0x3F, 0x00, 0xFF, 0x01,
+0xBE, 0x1F, 0x7C, 0xFC, 0x7C, 0xE0, 0xF7, 0x00, 0xFE, 0x01, 0xF0, 0x03, 0x80, 0x07, 0x00, 0x0C,
+// L
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x0C, 0x00, 0x30,
+0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x0C,
+// M
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF8, 0x1F, 0x80, 0xFF, 0x03,
+0xF0, 0x0F, 0x00, 0x3E, 0x00, 0xFF, 0x80, 0xFF, 0xC1, 0xFF, 0x00, 0x7F, 0x00, 0xFC, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF,
+// N
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x07, 0x80, 0x7F, 0x00,
+0xF8, 0x07, 0x80, 0x3F, 0x00, 0xFC, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0x3F,
+// O
+0xC0, 0x0F, 0xE0, 0xFF, 0xC1, 0xFF, 0x8F, 0xFF, 0x7F, 0xFE, 0xFF, 0x3D, 0x00, 0x7F, 0x00, 0xF8,
+0x00, 0xC0, 0x03, 0x00, 0x0F, 0x00, 0x7C, 0x00, 0xF8, 0x03, 0xF0, 0xFE, 0xFF, 0xF9, 0xFF, 0xC7,
+0xFF, 0x0F, 0xFE, 0x1F,
+// P
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x18, 0x30, 0x60, 0xC0,
+0x80, 0x01, 0x03, 0x07, 0x1C, 0x1E, 0xF0, 0x3F, 0xC0, 0xFF, 0x00, 0xFE, 0x01, 0xF8, 0x07, 0x00,
+// Q
+0xC0, 0x0F, 0x00, 0xFE, 0x1F, 0xC0, 0xFF, 0x0F, 0xF8, 0xFF, 0x07, 0xFE, 0xFF, 0xC1, 0x03, 0xF0,
+0x70, 0x00, 0x38, 0x0C, 0x00, 0x0C, 0x03, 0x00, 0xC3, 0x00, 0xC0, 0x71, 0x00, 0xF8, 0x3C, 0x00,
+0x3F, 0xFE, 0xFF, 0x9F, 0xFF, 0x7F, 0xC7, 0xFF, 0x8F, 0xE3, 0xFF, 0xE1,
+// R
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x06, 0x0C, 0x38, 0x30, 0xF0, 0xC1,
+0xC1, 0x0F, 0xCF, 0x7F, 0xFC, 0xEF, 0xE7, 0x1F, 0xBF, 0x7F, 0xF8, 0x7C, 0xC0, 0x03, 0x00, 0x0C,
+// S
+0x7C, 0xC0, 0xF9, 0x03, 0xEE, 0x1F, 0xF8, 0x7F, 0xE0, 0xC7, 0x03, 0x0F, 0x0E, 0x3C, 0x38, 0xF0,
+0xE0, 0xC1, 0x03, 0x87, 0x0F, 0x3C, 0x7F, 0xF0, 0xDF, 0x81, 0x7F, 0x06, 0xFE, 0x00, 0xF0, 0x01,
+// T
+0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0xF0, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x30,
+0x00, 0xC0, 0x00, 0x00,
+// U
+0xFF, 0x1F, 0xFC, 0xFF, 0xF3, 0xFF, 0xDF, 0xFF, 0x7F, 0xFF, 0xFF, 0x03, 0x00, 0x0E, 0x00, 0x30,
+0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x0E, 0x00, 0xFE, 0xFF, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xF3,
+0xFF, 0x01,
+// V
+0x07, 0x00, 0x7C, 0x00, 0xF0, 0x0F, 0xC0, 0xFF, 0x01, 0xFC, 0x1F, 0xC0, 0xFF, 0x03, 0xF8, 0x3F,
+0x80, 0xFF, 0x00, 0xF0, 0x03, 0xF0, 0x0F, 0xF0, 0x3F, 0xF8, 0x3F, 0xF8, 0x1F, 0xFC, 0x0F, 0xF0,
+0x0F, 0xC0, 0x07, 0x00,
+// W
+0x7F, 0x00, 0xFC, 0xFF, 0xF0, 0xFF, 0xBF, 0xFF, 0xFF, 0x00, 0xFF, 0x03, 0xF8, 0x0F, 0xFF, 0x3F,
+0xFC, 0x1F, 0xF0, 0x07, 0xC0, 0xFF, 0x01, 0xFF, 0x3F, 0xC0, 0xFF, 0x00, 0xFC, 0xE3, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0x07,
+// X
+0x01, 0x00, 0x0E, 0x00, 0xFE, 0x00, 0xFC, 0x07, 0xF8, 0x3F, 0xF8, 0xF9, 0xF3, 0xC1, 0xFF, 0x03,
+0xFC, 0x07, 0xE0, 0x0F, 0x80, 0xFF, 0x80, 0xFF, 0x07, 0x1F, 0x3F, 0x3E, 0xF8, 0x7F, 0xC0, 0xFF,
+0x00, 0xFC, 0x00, 0xE0,
+// Y
+0x01, 0x00, 0x1C, 0x00, 0xF0, 0x01, 0xC0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x07, 0x00, 0xFF, 0x3F,
+0xF8, 0xFF, 0x80, 0xFF, 0x03, 0xFF, 0x0F, 0xFE, 0x3F, 0x7E, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xF0,
+0x01, 0xC0, 0x01, 0x00,
+// Z
+0x03, 0x80, 0x0F, 0x00, 0x3F, 0x00, 0xFE, 0x00, 0xFE, 0x03, 0xFC, 0x0F, 0xF8, 0x3D, 0xF0, 0xF1,
+0xF0, 0xC3, 0xE3, 0x07, 0xCF, 0x0F, 0xBC, 0x0F, 0xF0, 0x1F, 0xC0, 0x3F, 0x00, 0x7F, 0x00, 0xFC,
+0x00, 0x30,
+// [
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x38,
+0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07,
+0x00, 0x00, 0x06,
+// backslash
+0x03, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x07, 0x00, 0xC0, 0x3F, 0x00, 0x00,
+0xFE, 0x01, 0x00, 0xF0, 0x0F, 0x00, 0x80, 0x7F, 0x00, 0x00, 0xFC, 0x03, 0x00, 0xE0, 0x1F, 0x00,
+0x00, 0xFF, 0x00, 0x00, 0xF8, 0x07, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x70,
+// ]
+0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38,
+0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0x07,
+// ^
+0x00, 0x80, 0x01, 0xE0, 0x03, 0xF0, 0x07, 0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0x81, 0xFF, 0x80, 0x3F,
+0x00, 0xFF, 0x01, 0xF0, 0x1F, 0x80, 0xFF, 0x00, 0xFC, 0x07, 0xC0, 0x1F, 0x00, 0x3E, 0x00, 0x70,
+// _
+0xFF, 0xFF, 0xFF, 0xFF,
+// `
+0x0F,
+// a
+0x00, 0x1E, 0x83, 0x9F, 0xE1, 0xFF, 0xF0, 0x7F, 0xBC, 0x1F, 0x0E, 0x0F, 0x83, 0x87, 0xC1, 0xC7,
+0xF0, 0xFF, 0xDF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xC7, 0xFF, 0x03, 0x80, 0x01,
+// b
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x38, 0xC0, 0x81, 0x03, 0x38,
+0x30, 0x00, 0x06, 0x06, 0xC0, 0xC0, 0x01, 0x1C, 0x78, 0xE0, 0x03, 0xFF, 0x3F, 0xC0, 0xFF, 0x07,
+0xF8, 0x7F, 0x00, 0xFC, 0x03,
+// c
+0xC0, 0x01, 0xFC, 0x07, 0xFF, 0xC7, 0xFF, 0xE7, 0xFF, 0xFB, 0xE0, 0x1F, 0xC0, 0x0F, 0xE0, 0x03,
+0xE0, 0x01, 0xF0, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x3F, 0x80, 0x1B, 0xC0, 0x00,
+// d
+0x00, 0xFC, 0x01, 0xE0, 0xFF, 0x00, 0xFE, 0x3F, 0xC0, 0xFF, 0x0F, 0xFC, 0xF9, 0x81, 0x03, 0x38,
+0x30, 0x00, 0x06, 0x06, 0xC0, 0xC0, 0x00, 0x1C, 0x38, 0xC0, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+// e
+0xE0, 0x03, 0xFC, 0x07, 0xFF, 0xC7, 0xFF, 0xE7, 0xFF, 0x7B, 0xC6, 0x1F, 0xC3, 0x87, 0xC1, 0xC3,
+0xE0, 0x63, 0xF0, 0x3F, 0xF8, 0x1F, 0xEC, 0x0F, 0xE7, 0x87, 0xC3, 0xC3, 0x00,
+// f
+0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x03, 0x00, 0x60, 0x00, 0x80, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x18, 0x00, 0x04, 0x03, 0x80, 0x60, 0x00, 0x10,
+0x0C, 0x00, 0x82, 0x01, 0xC0, 0x30, 0x00, 0x00,
+// g
+0xF0, 0x07, 0xC0, 0xFF, 0xC1, 0xFE, 0x3F, 0xEC, 0xFF, 0xC7, 0x3F, 0x7E, 0x78, 0x00, 0x87, 0x03,
+0x60, 0x38, 0x00, 0x86, 0x07, 0x70, 0x7C, 0x80, 0xC3, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xF7, 0xFF, 0x3F, 0xFF, 0x7F, 0x00,
+// h
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x78, 0x00, 0x80, 0x07, 0x00,
+0x70, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0xFF, 0x7F, 0xE0, 0xFF, 0x0F,
+0xF8, 0xFF, 0x01, 0xFC, 0x3F,
+// i
+0xC0, 0x00, 0x00, 0x18, 0x00, 0x00, 0x03, 0x00, 0x60, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x01, 0xC0,
+0xF0, 0xFF, 0x1F, 0xFE, 0xFF, 0xC3, 0xFF, 0x7F, 0xF8, 0xFF, 0x0F, 0x00, 0x00,
+// j
+0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x0C, 0x0C, 0x00, 0x30, 0x30, 0x00, 0x80, 0xC0, 0x00, 0x00,
+0x02, 0x03, 0x00, 0x08, 0x0C, 0x00, 0xF0, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
+0x3F, 0xFC, 0xFF, 0xDF, 0xF0, 0xFF, 0x1F,
+// k
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x07, 0x00, 0xF8, 0x01,
+0x80, 0x7F, 0x00, 0xF8, 0x1F, 0x80, 0xCF, 0x07, 0xF8, 0xF0, 0x03, 0x0F, 0x7C, 0xE0, 0x00, 0x0F,
+0x0C, 0xC0, 0x81, 0x00, 0x30,
+// l
+0x01, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x02, 0x00, 0xC0,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+// m
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x78, 0x00, 0x7C, 0x00, 0xFE, 0xFF, 0xFF,
+0x7F, 0xFF, 0xBF, 0x0F, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
+// n
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x78, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x03,
+0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xC7, 0xFF, 0x03,
+// o
+0xF0, 0x07, 0xFE, 0x8F, 0xFF, 0xCF, 0xFF, 0xF7, 0xC1, 0x3F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x03,
+0xE0, 0x03, 0xF8, 0x07, 0xDF, 0xFF, 0xE7, 0xFF, 0xE3, 0xFF, 0xE0, 0x3F, 0x00,
+// p
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x78, 0x70, 0x00, 0x07, 0x03,
+0x60, 0x30, 0x00, 0x06, 0x07, 0x70, 0xF0, 0xC0, 0x07, 0xFF, 0x7F, 0xE0, 0xFF, 0x03, 0xFE, 0x1F,
+0x80, 0x7F, 0x00,
+// q
+0xF0, 0x0F, 0xC0, 0xFF, 0x01, 0xFE, 0x3F, 0xE0, 0xFF, 0x07, 0x1F, 0x7C, 0x70, 0x00, 0x07, 0x03,
+0x60, 0x30, 0x00, 0x06, 0x07, 0x70, 0x70, 0x80, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF,
+// r
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x03,
+0x80, 0x01, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0x00,
+// s
+0x38, 0x30, 0x3F, 0xB8, 0x1F, 0xFC, 0x1F, 0xFE, 0x0F, 0x1E, 0x07, 0x0F, 0x87, 0x87, 0xC3, 0xC3,
+0xF3, 0xC1, 0xFF, 0xE1, 0xEF, 0xF0, 0x67, 0xF0, 0x01,
+// t
+0x18, 0x00, 0x60, 0x00, 0x80, 0x01, 0x00, 0x06, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xF7, 0xFF, 0xFF,
+0xFF, 0xFF, 0x18, 0x80, 0x63, 0x00, 0x8C, 0x01, 0x30, 0x06, 0xC0, 0x18, 0x00, 0x63, 0x00, 0x8C,
+0x01, 0x30,
+// u
+0xFF, 0x9F, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x07, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00,
+0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+// v
+0x01, 0x80, 0x03, 0xC0, 0x0F, 0xE0, 0x1F, 0xE0, 0x7F, 0xC0, 0xFF, 0x80, 0xFF, 0x01, 0xFE, 0x00,
+0x7C, 0x80, 0x3F, 0xF0, 0x1F, 0xFF, 0xE3, 0x3F, 0xF8, 0x07, 0xFC, 0x00, 0x0E, 0x00,
+// w
+0x3F, 0x80, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x0F, 0xFC, 0x07, 0xFE, 0xF3, 0xFF, 0xFD, 0x0F, 0x7E,
+0x00, 0xFF, 0x83, 0xFF, 0x1F, 0xFE, 0x0F, 0xF0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+// x
+0x01, 0xC0, 0x03, 0xF8, 0x03, 0xFE, 0x83, 0xFF, 0xF7, 0xF3, 0xFF, 0xE0, 0x1F, 0xE0, 0x0F, 0xF0,
+0x0F, 0xFE, 0x8F, 0xDF, 0xFF, 0xC3, 0xFF, 0x80, 0x1F, 0x80, 0x07, 0x80, 0x01,
+// y
+0x01, 0x00, 0x70, 0x00, 0x80, 0x1F, 0x00, 0xF8, 0x0F, 0x80, 0xFF, 0x03, 0xCC, 0xFF, 0xE0, 0xE0,
+0xFF, 0x0F, 0xF8, 0xFF, 0x00, 0xFE, 0x07, 0xF0, 0x1F, 0xE0, 0x3F, 0x80, 0xFF, 0x00, 0xFE, 0x03,
+0xF0, 0x0F, 0x00, 0x1F, 0x00, 0x70, 0x00, 0x00,
+// z
+0x00, 0xE0, 0x01, 0xF8, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x1F, 0x7C, 0x0F, 0x9F, 0xC7, 0xC7, 0xF3,
+0xE1, 0x7D, 0xF0, 0x1F, 0xF8, 0x07, 0xFC, 0x01, 0x7E, 0x00, 0x1F, 0x80, 0x01,
+// {
+0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0xC3, 0xC3, 0xE7,
+0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xF3, 0xFF, 0xC3, 0x81, 0xC3, 0x03, 0x00, 0x00, 0x07,
+0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x18,
+// |
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+// }
+0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x3C, 0x18, 0x18, 0xFC,
+0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x7F, 0x3E, 0x3C, 0x7C, 0x00, 0x30, 0x00, 0x00,
+0x60, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x01, 0x00,
+// ~
+0xD8, 0xFF, 0x3F, 0xC6, 0x79, 0xCE, 0x73, 0x8C, 0xFF, 0x7F,
+};
+
+static const PackedGlyph PackedFont16x26_glyphs [] = {
+	{0, 0, 8, 0, 0},	// sp
+	{0, 5, 6, 0, 21},	// !
+	{14, 11, 12, 0, 7},	// "
+	{24, 16, 17, 0, 21},	// #
+	{66, 13, 14, 0, 23},	// $
+	{104, 16, 17, 0, 21},	// %
+	{146, 16, 17, 0, 21},	// &
+	{188, 5, 6, 0, 7},	// '
+	{193, 12, 13, 0, 25},	// (
+	{231, 12, 13, 0, 25},	// )
+	{269, 14, 15, 0, 12},	// *
+	{290, 16, 17, 6, 15},	// +
+	{320, 5, 6, 17, 9},	// ,
+	{326, 13, 14, 11, 2},	// -
+	{330, 5, 6, 17, 4},	// .
+	{333, 16, 17, 0, 25},	// /
+	{383, 15, 16, 0, 21},	// 0
+	{423, 14, 15, 0, 21},	// 1
+	{460, 13, 14, 0, 21},	// 2
+	{495, 12, 13, 0, 21},	// 3
+	{527, 16, 17, 0, 21},	// 4
+	{569, 12, 13, 0, 21},	// 5
+	{601, 15, 16, 0, 21},	// 6
+	{641, 14, 15, 0, 21},	// 7
+	{678, 15, 16, 0, 21},	// 8
+	{718, 15, 16, 0, 21},	// 9
+	{758, 5, 6, 6, 15},	// :
+	{768, 5, 6, 6, 20},	// ;
+	{781, 16, 17, 6, 15},	// <
+	{811, 16, 17, 10, 7},	// =
+	{825, 16, 17, 6, 15},	// >
+	{855, 14, 15, 0, 21},	// ?
+	{892, 16, 17, 0, 21},	// @
+	{934, 16, 17, 3, 18},	// A
+	{970, 14, 15, 3, 18},	// B
+	{1002, 15, 16, 3, 18},	// C
+	{1036, 15, 16, 3, 18},	// D
+	{1070, 14, 15, 3, 18},	// E
+	{1102, 13, 14, 3, 18},	// F
+	{1132, 16, 17, 3, 18},	// G
+	{1168, 15, 16, 3, 18},	// H
+	{1202, 14, 15, 3, 18},	// I
+	{1234, 12, 13, 3, 18},	// J
+	{1261, 14, 15, 3, 18},	// K
+	{1293, 14, 15, 3, 18},	// L
+	{1325, 16, 17, 3, 18},	// M
+	{1361, 15, 16, 3, 18},	// N
+	{1395, 16, 17, 3, 18},	// O
+	{1431, 14, 15, 3, 18},	// P
+	{1463, 16, 17, 3, 22},	// Q
+	{1507, 14, 15, 3, 18},	// R
+	{1539, 14, 15, 3, 18},	// S
+	{1571, 16, 17, 3, 18},	// T
+	{1607, 15, 16, 3, 18},	// U
+	{1641, 16, 17, 3, 18},	// V
+	{1677, 16, 17, 3, 18},	// W
+	{1713, 16, 17, 3, 18},	// X
+	{1749, 16, 17, 3, 18},	// Y
+	{1785, 15, 16, 3, 18},	// Z
+	{1819, 11, 12, 0, 25},	// [
+	{1854, 15, 16, 0, 25},	// backslash
+	{1901, 11, 12, 0, 25},	// ]
+	{1936, 15, 16, 0, 17},	// ^
+	{1968, 16, 17, 21, 2},	// _
+	{1972, 4, 5, 0, 1},	// `
+	{1973, 15, 16, 6, 15},	// a
+	{2002, 14, 15, 0, 21},	// b
+	{2039, 15, 16, 6, 15},	// c
+	{2068, 15, 16, 0, 21},	// d
+	{2108, 15, 16, 6, 15},	// e
+	{2137, 15, 16, 0, 21},	// f
+	{2177, 15, 16, 6, 20},	// g
+	{2215, 14, 15, 0, 21},	// h
+	{2252, 11, 12, 0, 21},	// i
+	{2281, 12, 13, 0, 26},	// j
+	{2320, 14, 15, 0, 21},	// k
+	{2357, 11, 12, 0, 21},	// l
+	{2386, 16, 17, 6, 15},	// m
+	{2416, 14, 15, 6, 15},	// n
+	{2443, 15, 16, 6, 15},	// o
+	{2472, 14, 15, 6, 20},	// p
+	{2507, 14, 15, 6, 20},	// q
+	{2542, 13, 14, 6, 15},	// r
+	{2567, 13, 14, 6, 15},	// s
+	{2592, 15, 16, 3, 18},	// t
+	{2626, 13, 14, 6, 15},	// u
+	{2651, 16, 17, 6, 15},	// v
+	{2681, 16, 17, 6, 15},	// w
+	{2711, 15, 16, 6, 15},	// x
+	{2740, 16, 17, 6, 20},	// y
+	{2780, 15, 16, 6, 15},	// z
+	{2809, 13, 14, 0, 25},	// {
+	{2850, 3, 4, 0, 25},	// |
+	{2860, 13, 14, 0, 25},	// }
+	{2901, 16, 17, 11, 5},	// ~
+};
+
+static const PackedKernPair PackedFont16x26_kerning [] = {
+	{'A', 'T', -3}, {'A', 'V', -3}, {'A', 'Y', -3}, {'A', 'f', -3},
+	{'A', 'i', -3}, {'A', 'j', -3}, {'A', 'l', -3}, {'A', 't', -3},
+	{'A', 'v', -3}, {'A', 'y', -3}, {'F', ',', -3}, {'F', '.', -3},
+	{'F', 'A', -2}, {'F', 'a', -2}, {'F', 'f', -3}, {'F', 'i', -3},
+	{'F', 'j', -3}, {'F', 'l', -3}, {'F', 't', -3}, {'F', 'v', -2},
+	{'F', 'x', -3}, {'F', 'y', -2}, {'F', 'z', -3}, {'L', '0', -2},
+	{'L', '4', -3}, {'L', '6', -2}, {'L', 'C', -2}, {'L', 'G', -3},
+	{'L', 'O', -2}, {'L', 'Q', -2}, {'L', 'T', -3}, {'L', 'V', -3},
+	{'L', 'W', -2}, {'L', 'Y', -3}, {'L', 'c', -2}, {'L', 'e', -2},
+	{'L', 'f', -3}, {'L', 'i', -3}, {'L', 'j', -3}, {'L', 'l', -3},
+	{'L', 't', -3}, {'L', 'v', -3}, {'L', 'w', -2}, {'L', 'y', -3},
+	{'P', ',', -3}, {'P', '.', -3}, {'P', '2', -2}, {'P', '7', -2},
+	{'P', 'A', -3}, {'P', 'l', -3}, {'T', ',', -3}, {'T', '.', -3},
+	{'T', '4', -3}, {'T', 'A', -3}, {'T', 'C', -2}, {'T', 'G', -3},
+	{'T', 'O', -2}, {'T', 'Q', -2}, {'T', 'a', -3}, {'T', 'c', -3},
+	{'T', 'd', -3}, {'T', 'e', -3}, {'T', 'f', -3}, {'T', 'g', -3},
+	{'T', 'i', -3}, {'T', 'j', -3}, {'T', 'l', -3}, {'T', 'm', -3},
+	{'T', 'n', -3}, {'T', 'o', -3}, {'T', 'p', -3}, {'T', 'q', -3},
+	{'T', 'r', -3}, {'T', 's', -3}, {'T', 't', -3}, {'T', 'u', -3},
+	{'T', 'v', -3}, {'T', 'w', -3}, {'T', 'x', -3}, {'T', 'y', -3},
+	{'T', 'z', -3}, {'V', ',', -3}, {'V', '.', -3}, {'V', '4', -2},
+	{'V', 'A', -3}, {'V', 'c', -2}, {'V', 'l', -3}, {'W', 'l', -3},
+	{'Y', ',', -3}, {'Y', '.', -3}, {'Y', '4', -3}, {'Y', 'A', -3},
+	{'Y', 'G', -2}, {'Y', 'a', -2}, {'Y', 'c', -3}, {'Y', 'd', -2},
+	{'Y', 'e', -3}, {'Y', 'g', -2}, {'Y', 'l', -3}, {'Y', 'o', -2},
+	{'Y', 'q', -2}, {'Y', 's', -2}, {'f', ',', -3}, {'f', '.', -3},
+	{'f', '4', -3}, {'f', 'A', -3}, {'f', 'I', -3}, {'f', 'J', -3},
+	{'f', 'T', -3}, {'f', 'X', -2}, {'f', 'Z', -3}, {'f', 'c', -2},
+	{'f', 'e', -2}, {'r', ',', -3}, {'r', '.', -3}, {'r', '1', -3},
+	{'r', '2', -3}, {'r', '7', -3}, {'r', 'A', -3}, {'r', 'I', -3},
+	{'r', 'J', -3}, {'r', 'T', -3}, {'r', 'X', -2}, {'r', 'Z', -3},
+	{'r', 'l', -3},
+};
+
+PackedFontDef PackedFont_16x26 = {26, ' ', '~',
+		PackedFont16x26_glyphs, PackedFont16x26_data,
+		PackedFont16x26_kerning,
+		sizeof(PackedFont16x26_kerning) / sizeof(PackedFont16x26_kerning[0])};
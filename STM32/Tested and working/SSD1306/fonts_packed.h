@@ -0,0 +1,79 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Bit-packed proportional fonts for the SSD1306 library
+ *
+ * Glyphs are cropped to their inked bounding box and stored column by
+ * column, top pixel first, as one continuous LSB-first bit stream per
+ * glyph. A column is therefore exactly the shape of a (shifted) SSD1306
+ * page column and can be OR-ed into the page buffer as it is decoded,
+ * no scratch bitmap is needed. Glyphs may be up to 32 pixels tall and of
+ * any width.
+ *
+ * The PackedFont_* fonts are the glyphs of the fixed width fonts in
+ * fonts.c, cropped, packed and with a one pixel gap after every glyph.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef FONTS_PACKED_H_
+#define FONTS_PACKED_H_
+
+#include <stdint.h>
+
+typedef struct {
+	uint16_t offset;	/*!< Byte offset of the glyph's bit stream in data */
+	uint8_t width;		/*!< Number of stored (inked) columns */
+	uint8_t advance;	/*!< Cursor advance in pixels */
+	uint8_t y_offset;	/*!< Blank rows above the first stored row */
+	uint8_t rows;		/*!< Number of stored rows per column */
+} PackedGlyph;
+
+typedef struct {
+	char first;		/*!< Left character of the pair */
+	char second;	/*!< Right character of the pair */
+	int8_t adjust;	/*!< Change to the left character's advance in pixels */
+} PackedKernPair;
+
+typedef struct {
+	uint8_t height;					/*!< Line height in pixels, max 32 */
+	char first_char;				/*!< First character in glyphs */
+	char last_char;					/*!< Last character in glyphs */
+	const PackedGlyph* glyphs;		/*!< One entry per character */
+	const uint8_t* data;			/*!< Packed glyph bit streams */
+	const PackedKernPair* kerning;	/*!< Pairs sorted by first then second, may be NULL */
+	uint16_t kerning_count;			/*!< Number of kerning pairs */
+} PackedFontDef;
+
+extern PackedFontDef PackedFont_7x10;
+extern PackedFontDef PackedFont_11x18;
+extern PackedFontDef PackedFont_16x26;
+
+/**
+ * @brief Looks up the kerning adjustment between two characters
+ *
+ * @return Pixels to add to the advance of the first character, 0 if the
+ * pair is not kerned
+ **/
+int8_t packed_font_kerning(const PackedFontDef* font, char first, char second);
+
+#endif /* FONTS_PACKED_H_ */
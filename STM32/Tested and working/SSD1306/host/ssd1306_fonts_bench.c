@@ -0,0 +1,174 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Host check and benchmark of the packed SSD1306 fonts
+ *	
+ * Draws every printable character with the fixed fonts of fonts.c and the
+ * packed fonts of fonts_packed.c and checks that the packed glyph has the
+ * same pixels as the inked columns of the fixed one, without touching
+ * the pixels beside it. The kerning tables are checked to be sorted and
+ * every pair to be found by packed_font_kerning. Finally both renderers
+ * are timed in glyphs per second.
+ *
+ * Build and run from the SSD1306 directory:
+ *	gcc -O2 -Ihost -I. host/ssd1306_fonts_bench.c ssd1306.c fonts.c \
+ *		fonts_packed.c host/ssd1306_host.c -o fonts_bench
+ *	./fonts_bench
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "ssd1306.h"
+#include "ssd1306_host.h"
+
+#define BENCH_STRINGS	20000
+
+static FontDef* fixed_fonts[] = {&Font_7x10, &Font_11x18, &Font_16x26};
+static PackedFontDef* packed_fonts[] = {&PackedFont_7x10, &PackedFont_11x18,
+		&PackedFont_16x26};
+
+static uint8_t pixel(const uint8_t* buffer, uint8_t width, int x, int y)
+{
+	return (buffer[x + (y / 8) * width] >> (y % 8)) & 0x01;
+}
+
+//packed glyph at x 40 against the fixed glyph at x 0, both on row 3
+static uint32_t check_glyph(SSD1306_device_t* dev, FontDef* fixed,
+		PackedFontDef* packed, char c)
+{
+	static uint8_t reference[sizeof(dev->buffer)];
+	uint32_t errors = 0;
+	int first = fixed->FontWidth, advance, x, y, column;
+	uint8_t expected;
+
+	memset(dev->buffer, 0xAA, sizeof(dev->buffer));
+	dev->x = 0;
+	dev->y = 3;
+	ssd1306_write_char(dev, c, *fixed, White);
+	memcpy(reference, dev->buffer, sizeof(reference));
+
+	//packed glyphs start at the first inked column
+	for(x = 0; x < fixed->FontWidth; x++)
+		for(y = 0; y < fixed->FontHeight; y++)
+			if(pixel(reference, dev->width, x, y + 3) && x < first)
+				first = x;
+	if(first == fixed->FontWidth)
+		first = 0;
+
+	memset(dev->buffer, 0x55, sizeof(dev->buffer));
+	dev->x = 40;
+	ssd1306_write_char_packed(dev, c, packed, White);
+	advance = dev->x - 40;
+
+	for(x = 0; x < advance; x++)
+		for(y = 0; y < packed->height; y++){
+			column = x + first;
+			expected = (column < fixed->FontWidth) ?
+					pixel(reference, dev->width, column, y + 3) : 0;
+			if(pixel(dev->buffer, dev->width, 40 + x, y + 3) != expected)
+				errors++;
+		}
+
+	//the column before the glyph is left alone
+	if(pixel(dev->buffer, dev->width, 39, 3) != ((0x55 >> 3) & 0x01))
+		errors++;
+
+	return errors;
+}
+
+static uint32_t check_kerning(PackedFontDef* font)
+{
+	uint32_t errors = 0;
+	uint16_t i, key, last = 0;
+
+	for(i = 0; i < font->kerning_count; i++){
+		key = ((uint8_t)font->kerning[i].first << 8) |
+				(uint8_t)font->kerning[i].second;
+		if(i && key <= last)
+			errors++;
+		last = key;
+		if(packed_font_kerning(font, font->kerning[i].first,
+				font->kerning[i].second) != font->kerning[i].adjust)
+			errors++;
+	}
+
+	return errors;
+}
+
+int main(void)
+{
+	static ssd1306_host_t panel;
+	I2C_HandleTypeDef hi2c;
+	SSD1306_device_init_t init = {.background = Black, .font = &Font_7x10,
+			.width = 128, .height = 64, .port = &hi2c};
+	SSD1306_device_t* dev;
+	uint32_t errors = 0, glyphs;
+	double fixed_s, packed_s;
+	clock_t start;
+	uint8_t font;
+	char c;
+	int i;
+
+	ssd1306_host_init(&panel, 128, 64);
+	ssd1306_host_attach(&panel, &hi2c);
+	dev = ssd1306_init(&init);
+	if(dev == NULL)
+		return 1;
+
+	for(font = 0; font < 3; font++){
+		for(c = ' '; c <= '~'; c++)
+			errors += check_glyph(dev, fixed_fonts[font], packed_fonts[font], c);
+		errors += check_kerning(packed_fonts[font]);
+	}
+	printf("%lu pixel and kerning mismatches\n", (unsigned long)errors);
+
+	for(font = 0; font < 3; font++){
+		glyphs = 0;
+		start = clock();
+		for(i = 0; i < BENCH_STRINGS; i++){
+			dev->x = 0;
+			dev->y = 0;
+			for(c = 'A'; c <= 'J'; c++, glyphs++)
+				ssd1306_write_char(dev, c, *fixed_fonts[font], White);
+		}
+		fixed_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+		start = clock();
+		for(i = 0; i < BENCH_STRINGS; i++){
+			dev->x = 0;
+			dev->y = 0;
+			for(c = 'A'; c <= 'J'; c++)
+				ssd1306_write_char_packed(dev, c, packed_fonts[font], White);
+		}
+		packed_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+		printf("%ux%u: fixed %.1fM glyphs/s, packed %.1fM glyphs/s\n",
+				fixed_fonts[font]->FontWidth, fixed_fonts[font]->FontHeight,
+				glyphs / fixed_s / 1e6, glyphs / packed_s / 1e6);
+	}
+
+	return errors ? 1 : 0;
+}
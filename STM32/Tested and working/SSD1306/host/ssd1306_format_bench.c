@@ -0,0 +1,125 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Host check and benchmark of the SSD1306 number formatting
+ *	
+ * Checks the ssd1306_fmt_* formatters against snprintf over edge cases
+ * and a pseudo random sweep, then times both. Nothing is drawn, the
+ * library is only linked for ssd1306_write_string.
+ *
+ * Build and run from the SSD1306 directory:
+ *	gcc -O2 -Ihost -I. host/ssd1306_format_bench.c ssd1306_format.c \
+ *		ssd1306.c fonts.c fonts_packed.c host/ssd1306_host.c -o format_bench
+ *	./format_bench
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "ssd1306_format.h"
+
+#define BENCH_RUNS		10000000
+
+static uint32_t failures = 0;
+
+static void check(const char* what, const char* got, const char* expected)
+{
+	if(strcmp(got, expected)){
+		printf("%s: \"%s\", snprintf gives \"%s\"\n", what, got, expected);
+		failures++;
+	}
+}
+
+static void check_value(int32_t value)
+{
+	char buf[SSD1306_FMT_BUF_SIZE], ref[32];
+	uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+	uint32_t scale = 1;
+	uint8_t decimals;
+
+	ssd1306_fmt_int(buf, value, 0, ' ');
+	snprintf(ref, sizeof(ref), "%ld", (long)value);
+	check("int", buf, ref);
+
+	ssd1306_fmt_int(buf, value, 8, '0');
+	snprintf(ref, sizeof(ref), "%08ld", (long)value);
+	check("int zero padded", buf, ref);
+
+	ssd1306_fmt_int(buf, value, 8, ' ');
+	snprintf(ref, sizeof(ref), "%8ld", (long)value);
+	check("int space padded", buf, ref);
+
+	ssd1306_fmt_uint(buf, (uint32_t)value, 0, ' ');
+	snprintf(ref, sizeof(ref), "%lu", (unsigned long)(uint32_t)value);
+	check("uint", buf, ref);
+
+	for(decimals = 1; decimals <= 3; decimals++){
+		scale *= 10;
+		ssd1306_fmt_fixed(buf, value, decimals);
+		snprintf(ref, sizeof(ref), "%s%lu.%0*lu", value < 0 ? "-" : "",
+				(unsigned long)(magnitude / scale), decimals,
+				(unsigned long)(magnitude % scale));
+		check("fixed", buf, ref);
+	}
+}
+
+int main(void)
+{
+	static const int32_t edges[] = {0, 1, -1, 9, 10, -10, 99, 100, 999, 1000,
+			12345, -12345, 2147483647, -2147483647 - 1};
+	char buf[SSD1306_FMT_BUF_SIZE], ref[32];
+	volatile uint32_t sink = 0;
+	double fmt_ns, snprintf_ns;
+	clock_t start;
+	uint32_t i;
+
+	for(i = 0; i < sizeof(edges) / sizeof(edges[0]); i++)
+		check_value(edges[i]);
+	for(i = 0; i < 1000000; i++)
+		check_value((int32_t)(i * 2654435761u));
+
+	ssd1306_fmt_hms(buf, 9, 5, 59);
+	check("hms", buf, "09:05:59");
+	ssd1306_fmt_q(buf, -(3 << 16) - 32768, 16, 2);
+	check("q", buf, "-3.50");
+	ssd1306_fmt_q(buf, -1, 16, 2);
+	check("q rounding to zero", buf, "0.00");
+
+	start = clock();
+	for(i = 0; i < BENCH_RUNS; i++)
+		sink += ssd1306_fmt_int(buf, (int32_t)(i * 2654435761u), 0, ' ');
+	fmt_ns = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / BENCH_RUNS;
+
+	start = clock();
+	for(i = 0; i < BENCH_RUNS; i++)
+		sink += snprintf(ref, sizeof(ref), "%ld", (long)(int32_t)(i * 2654435761u));
+	snprintf_ns = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / BENCH_RUNS;
+
+	printf("int32 to text: ssd1306_fmt_int %.1f ns, snprintf %.1f ns\n",
+			fmt_ns, snprintf_ns);
+	printf("%lu mismatches\n", (unsigned long)failures);
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,369 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Virtual SSD1306 panel for running the SSD1306 library on a host
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ssd1306_host.h"
+
+//control bytes, the D/C# bit selects data
+#define SSD1306_CONTROL_DC		0x40
+
+static uint32_t host_tick = 0;
+
+void HAL_Delay(uint32_t Delay)
+{
+	host_tick += Delay;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return host_tick;
+}
+
+static void ssd1306_host_count(ssd1306_host_t* panel, uint8_t data,
+		uint16_t length)
+{
+	SSD1306_host_stats_t* stats[2] = {&panel->frame, &panel->total};
+	uint8_t i;
+
+	for(i = 0; i < 2; i++){
+		stats[i]->transactions++;
+		//address byte and control byte
+		stats[i]->bus_bytes += length + 2;
+		if(data)
+			stats[i]->data_bytes += length;
+		else
+			stats[i]->command_bytes += length;
+	}
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c,
+		uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize,
+		uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	ssd1306_host_t* panel = (ssd1306_host_t*)hi2c->panel;
+
+	(void)DevAddress;
+	(void)MemAddSize;
+	(void)Timeout;
+
+	if(panel == NULL)
+		return HAL_ERROR;
+
+	ssd1306_host_count(panel, MemAddress & SSD1306_CONTROL_DC, Size);
+
+	if(MemAddress & SSD1306_CONTROL_DC)
+		ssd1306_host_data(panel, pData, Size);
+	else
+		ssd1306_host_command(panel, pData, Size);
+
+	return HAL_OK;
+}
+
+void ssd1306_host_init(ssd1306_host_t* panel, uint8_t width, uint8_t height)
+{
+	memset(panel, 0, sizeof(ssd1306_host_t));
+
+	panel->width = (width > SSD1306_HOST_COLUMNS) ? SSD1306_HOST_COLUMNS : width;
+	panel->height = (height > SSD1306_HOST_ROWS) ? SSD1306_HOST_ROWS : height;
+
+	//reset values from the datasheet
+	panel->addressing = SSD1306_HOST_PAGE;
+	panel->column_end = SSD1306_HOST_COLUMNS - 1;
+	panel->page_end = SSD1306_HOST_PAGES - 1;
+	panel->multiplex = SSD1306_HOST_ROWS - 1;
+	panel->contrast = 0x7F;
+}
+
+void ssd1306_host_attach(ssd1306_host_t* panel, I2C_HandleTypeDef* hi2c)
+{
+	hi2c->panel = panel;
+}
+
+//number of parameter bytes that follow a command byte
+static uint8_t ssd1306_host_parameters(uint8_t command)
+{
+	switch(command){
+	case 0x20:	//memory addressing mode
+	case 0x81:	//contrast
+	case 0x8D:	//charge pump
+	case 0xA8:	//multiplex ratio
+	case 0xD3:	//display offset
+	case 0xD5:	//clock divide
+	case 0xD9:	//pre-charge period
+	case 0xDA:	//COM pins
+	case 0xDB:	//VCOMH deselect
+		return 1;
+	case 0x21:	//column address
+	case 0x22:	//page address
+	case 0xA3:	//vertical scroll area
+		return 2;
+	case 0x29:	//vertical and horizontal scroll
+	case 0x2A:
+		return 5;
+	case 0x26:	//horizontal scroll
+	case 0x27:
+		return 6;
+	default:
+		return 0;
+	}
+}
+
+static void ssd1306_host_execute(ssd1306_host_t* panel)
+{
+	uint8_t* cmd = panel->command;
+
+	switch(cmd[0]){
+	case 0x20:
+		panel->addressing = (SSD1306_host_addressing_t)(cmd[1] & 0x03);
+		return;
+	case 0x21:
+		panel->column_start = cmd[1] & 0x7F;
+		panel->column_end = cmd[2] & 0x7F;
+		panel->column = panel->column_start;
+		return;
+	case 0x22:
+		panel->page_start = cmd[1] & 0x07;
+		panel->page_end = cmd[2] & 0x07;
+		panel->page = panel->page_start;
+		return;
+	case 0x81:
+		panel->contrast = cmd[1];
+		return;
+	case 0xA8:
+		if(cmd[1] >= 15)
+			panel->multiplex = cmd[1] & 0x3F;
+		return;
+	case 0xD3:
+		panel->display_offset = cmd[1] & 0x3F;
+		return;
+	case 0xA0:
+	case 0xA1:
+		panel->segment_remap = cmd[0] & 0x01;
+		return;
+	case 0xA4:
+	case 0xA5:
+		panel->entire_on = cmd[0] & 0x01;
+		return;
+	case 0xA6:
+	case 0xA7:
+		panel->inverted = cmd[0] & 0x01;
+		return;
+	case 0xAE:
+	case 0xAF:
+		panel->display_on = cmd[0] & 0x01;
+		return;
+	case 0xC0:
+	case 0xC8:
+		panel->com_remap = (cmd[0] >> 3) & 0x01;
+		return;
+	default:
+		break;
+	}
+
+	if(cmd[0] <= 0x0F){
+		panel->page_mode_column = (panel->page_mode_column & 0xF0) | cmd[0];
+		panel->column = panel->page_mode_column;
+	}else if(cmd[0] <= 0x1F){
+		panel->page_mode_column = (panel->page_mode_column & 0x0F) |
+				((cmd[0] & 0x07) << 4);
+		panel->column = panel->page_mode_column;
+	}else if(cmd[0] >= 0x40 && cmd[0] <= 0x7F){
+		panel->start_line = cmd[0] & 0x3F;
+	}else if(cmd[0] >= 0xB0 && cmd[0] <= 0xB7){
+		panel->page = cmd[0] & 0x07;
+	}
+	//timing, power and scroll setup have no effect on the image
+}
+
+void ssd1306_host_command(ssd1306_host_t* panel, const uint8_t* bytes,
+		uint16_t length)
+{
+	while(length--){
+		panel->command[panel->command_length++] = *bytes++;
+
+		if(panel->command_length == 1)
+			panel->command_expected = 1 +
+					ssd1306_host_parameters(panel->command[0]);
+
+		if(panel->command_length == panel->command_expected){
+			ssd1306_host_execute(panel);
+			panel->command_length = 0;
+		}
+	}
+}
+
+void ssd1306_host_data(ssd1306_host_t* panel, const uint8_t* bytes,
+		uint16_t length)
+{
+	while(length--){
+		panel->gddram[panel->page][panel->column] = *bytes++;
+
+		switch(panel->addressing){
+		case SSD1306_HOST_HORIZONTAL:
+			if(panel->column++ >= panel->column_end){
+				panel->column = panel->column_start;
+				if(panel->page++ >= panel->page_end)
+					panel->page = panel->page_start;
+			}
+			break;
+		case SSD1306_HOST_VERTICAL:
+			if(panel->page++ >= panel->page_end){
+				panel->page = panel->page_start;
+				if(panel->column++ >= panel->column_end)
+					panel->column = panel->column_start;
+			}
+			break;
+		default:
+			//page addressing wraps within the page
+			if(panel->column++ >= SSD1306_HOST_COLUMNS - 1)
+				panel->column = panel->page_mode_column;
+			break;
+		}
+	}
+}
+
+void ssd1306_host_end_frame(ssd1306_host_t* panel)
+{
+	panel->last_frame = panel->frame;
+	memset(&panel->frame, 0, sizeof(SSD1306_host_stats_t));
+	panel->frames++;
+}
+
+uint32_t ssd1306_host_bus_time_us(const SSD1306_host_stats_t* stats,
+		uint32_t bus_hz)
+{
+	uint64_t clocks = (uint64_t)stats->bus_bytes * 9 + stats->transactions * 2;
+
+	return (uint32_t)((clocks * 1000000) / bus_hz);
+}
+
+uint8_t ssd1306_host_get_pixel(ssd1306_host_t* panel, uint8_t x, uint8_t y)
+{
+	uint8_t segment, com, scan, column, row;
+
+	if(x >= panel->width || y >= panel->height || !panel->display_on)
+		return 0;
+	if(panel->entire_on)
+		return 1;
+
+	//on the modules the segments and COMs run right to left, bottom to top
+	segment = panel->width - 1 - x;
+	com = panel->height - 1 - y;
+
+	if(com > panel->multiplex)
+		return panel->inverted;
+
+	column = panel->segment_remap ? (SSD1306_HOST_COLUMNS - 1 - segment) : segment;
+	scan = panel->com_remap ? (panel->multiplex - com) : com;
+	row = (scan + panel->display_offset + panel->start_line) % SSD1306_HOST_ROWS;
+
+	return ((panel->gddram[row / 8][column] >> (row % 8)) & 0x01) ^ panel->inverted;
+}
+
+int ssd1306_host_write_pbm(ssd1306_host_t* panel, const char* path)
+{
+	FILE* file = fopen(path, "wb");
+	uint8_t x, y, byte;
+
+	if(file == NULL)
+		return -1;
+
+	fprintf(file, "P4\n%u %u\n", panel->width, panel->height);
+
+	for(y = 0; y < panel->height; y++){
+		byte = 0;
+		for(x = 0; x < panel->width; x++){
+			//PBM 1 is black
+			if(!ssd1306_host_get_pixel(panel, x, y))
+				byte |= 0x80 >> (x % 8);
+			if(x % 8 == 7 || x == panel->width - 1){
+				fputc(byte, file);
+				byte = 0;
+			}
+		}
+	}
+
+	if(fclose(file) != 0)
+		return -1;
+
+	return 0;
+}
+
+//reads the next whitespace separated number of a PBM header
+static int ssd1306_host_pbm_number(FILE* file)
+{
+	int c, value = 0, digits = 0;
+
+	while((c = fgetc(file)) != EOF){
+		if(c == '#'){
+			while((c = fgetc(file)) != EOF && c != '\n');
+		}else if(c >= '0' && c <= '9'){
+			value = value * 10 + (c - '0');
+			digits++;
+		}else if(digits){
+			break;
+		}
+	}
+
+	return digits ? value : -1;
+}
+
+int32_t ssd1306_host_compare_pbm(ssd1306_host_t* panel, const char* path)
+{
+	FILE* file = fopen(path, "rb");
+	int32_t differences = 0;
+	int byte = 0;
+	uint8_t x, y, golden;
+
+	if(file == NULL)
+		return -1;
+
+	if(fgetc(file) != 'P' || fgetc(file) != '4' ||
+			ssd1306_host_pbm_number(file) != panel->width ||
+			ssd1306_host_pbm_number(file) != panel->height){
+		fclose(file);
+		return -1;
+	}
+
+	for(y = 0; y < panel->height; y++){
+		for(x = 0; x < panel->width; x++){
+			if(x % 8 == 0 && (byte = fgetc(file)) == EOF){
+				fclose(file);
+				return -1;
+			}
+			golden = !((byte << (x % 8)) & 0x80);
+			if(golden != ssd1306_host_get_pixel(panel, x, y))
+				differences++;
+		}
+	}
+
+	fclose(file);
+
+	return differences;
+}
@@ -0,0 +1,186 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Virtual SSD1306 panel for running the SSD1306 library on a host
+ *
+ * The virtual panel decodes the command and data stream the driver sends
+ * into its own GDDRAM, honouring the addressing modes, column/page
+ * windows, start line, segment remap, COM scan direction, display offset,
+ * inversion and display on/off. What the glass would show can be read
+ * back pixel by pixel, dumped as a PBM image or compared against a golden
+ * PBM, and every transaction is counted so that the bus cost of a frame
+ * can be measured.
+ *
+ * Usage:
+ *	ssd1306_host_t panel;
+ *	I2C_HandleTypeDef hi2c;
+ *	ssd1306_host_init(&panel, 128, 64);
+ *	ssd1306_host_attach(&panel, &hi2c);
+ *	...init the driver with .port = &hi2c and draw as normal...
+ *	ssd1306_host_end_frame(&panel);
+ *	ssd1306_host_write_pbm(&panel, "frame.pbm");
+ *
+ * The visible image uses the orientation of the common 128x64 modules,
+ * where the driver's default segment remap (0xA1) and COM scan (0xC8)
+ * give an upright picture with RAM column 0 on the left and RAM row 0 at
+ * the top.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef SSD1306_HOST_H_
+#define SSD1306_HOST_H_
+
+#include <stdint.h>
+
+#include "stm32f4xx_hal.h"
+
+#define SSD1306_HOST_COLUMNS	128
+#define SSD1306_HOST_PAGES		8
+#define SSD1306_HOST_ROWS		(SSD1306_HOST_PAGES * 8)
+
+typedef enum {
+	SSD1306_HOST_HORIZONTAL = 0x00,
+	SSD1306_HOST_VERTICAL = 0x01,
+	SSD1306_HOST_PAGE = 0x02
+} SSD1306_host_addressing_t;
+
+/** Bus traffic counters */
+typedef struct {
+	uint32_t transactions;	/*!< Number of I2C writes */
+	uint32_t bus_bytes;		/*!< Bytes on the bus, including address and control bytes */
+	uint32_t command_bytes;	/*!< Command and command parameter bytes */
+	uint32_t data_bytes;	/*!< GDDRAM data bytes */
+} SSD1306_host_stats_t;
+
+typedef struct ssd1306_host ssd1306_host_t;
+struct ssd1306_host{
+	uint8_t gddram[SSD1306_HOST_PAGES][SSD1306_HOST_COLUMNS];
+
+	uint8_t width;				/*!< Panel segments in use */
+	uint8_t height;				/*!< Panel COMs in use */
+
+	//address pointer state
+	SSD1306_host_addressing_t addressing;
+	uint8_t column;
+	uint8_t page;
+	uint8_t column_start;
+	uint8_t column_end;
+	uint8_t page_start;
+	uint8_t page_end;
+	uint8_t page_mode_column;	/*!< Column start set by 0x00-0x1F */
+
+	//display state
+	uint8_t start_line;
+	uint8_t display_offset;
+	uint8_t multiplex;			/*!< Multiplex ratio, COMs scanned = multiplex + 1 */
+	uint8_t segment_remap;
+	uint8_t com_remap;
+	uint8_t inverted;
+	uint8_t entire_on;
+	uint8_t display_on;
+	uint8_t contrast;
+
+	//command decoder state
+	uint8_t command[8];
+	uint8_t command_length;
+	uint8_t command_expected;
+
+	SSD1306_host_stats_t frame;		/*!< Traffic since the last ssd1306_host_end_frame */
+	SSD1306_host_stats_t last_frame;	/*!< Traffic of the last completed frame */
+	SSD1306_host_stats_t total;		/*!< Traffic since ssd1306_host_init */
+	uint32_t frames;
+};
+
+/**
+ * @brief Resets the virtual panel to the controller's power on state
+ *
+ * @param panel - Virtual panel
+ * @param width - Panel width in pixels, max 128
+ * @param height - Panel height in pixels, max 64
+ **/
+void ssd1306_host_init(ssd1306_host_t* panel, uint8_t width, uint8_t height);
+
+/**
+ * @brief Routes HAL I2C writes made on the given handle to the virtual panel
+ **/
+void ssd1306_host_attach(ssd1306_host_t* panel, I2C_HandleTypeDef* hi2c);
+
+/**
+ * @brief Feeds command bytes (control byte 0x00) to the decoder
+ **/
+void ssd1306_host_command(ssd1306_host_t* panel, const uint8_t* bytes,
+		uint16_t length);
+
+/**
+ * @brief Feeds GDDRAM data bytes (control byte 0x40) to the decoder
+ **/
+void ssd1306_host_data(ssd1306_host_t* panel, const uint8_t* bytes,
+		uint16_t length);
+
+/**
+ * @brief Closes the current frame's traffic counters
+ *
+ * The counters are copied to last_frame and cleared for the next frame.
+ **/
+void ssd1306_host_end_frame(ssd1306_host_t* panel);
+
+/**
+ * @brief Estimated time the frame's traffic takes on the bus
+ *
+ * Counts 9 clocks per byte plus a start and stop per transaction.
+ *
+ * @param stats - Traffic counters
+ * @param bus_hz - Bus clock in Hz
+ * @return Time in microseconds
+ **/
+uint32_t ssd1306_host_bus_time_us(const SSD1306_host_stats_t* stats,
+		uint32_t bus_hz);
+
+/**
+ * @brief Returns the visible state of a pixel on the glass
+ *
+ * @param x - Column as seen on the panel, 0 is left
+ * @param y - Row as seen on the panel, 0 is top
+ * @return 1 if the pixel is lit
+ **/
+uint8_t ssd1306_host_get_pixel(ssd1306_host_t* panel, uint8_t x, uint8_t y);
+
+/**
+ * @brief Writes what the glass shows as a binary (P4) PBM
+ *
+ * Lit pixels are stored as 0 (white) so that viewers show the image the
+ * way the panel does.
+ *
+ * @return 0 on success, -1 if the file could not be written
+ **/
+int ssd1306_host_write_pbm(ssd1306_host_t* panel, const char* path);
+
+/**
+ * @brief Compares what the glass shows against a golden P4 PBM
+ *
+ * @return Number of differing pixels, -1 if the file could not be read
+ * or its size does not match the panel
+ **/
+int32_t ssd1306_host_compare_pbm(ssd1306_host_t* panel, const char* path);
+
+#endif /* SSD1306_HOST_H_ */
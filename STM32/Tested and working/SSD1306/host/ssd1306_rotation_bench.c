@@ -0,0 +1,285 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Host check and benchmark of SSD1306 rotation and mirroring
+ *	
+ * Draws a random pattern at every rotation and mirroring, sends it to the
+ * virtual panel over I2C and over a simulated DMA transport and compares
+ * every pixel on the glass with where the rotation should put it. The
+ * simulated transport only hands a transfer to the panel when it ends,
+ * so a page buffer reused too early shows up as wrong pixels. Then times
+ * ssd1306_update_screen at each rotation over the simulated DMA: the
+ * time the call waits for the bus and the CPU time it takes. Returns non
+ * zero on any wrong pixel.
+ *
+ * Build and run from the SSD1306 directory:
+ *	gcc -O2 -Wall -Ihost -I. host/ssd1306_rotation_bench.c ssd1306.c \
+ *		fonts.c fonts_packed.c host/ssd1306_host.c -o rotation_bench
+ *	./rotation_bench
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ssd1306.h"
+#include "ssd1306_host.h"
+
+#define SPI_HZ			8000000.0
+#define DMA_THRESHOLD	32
+#define BENCH_FRAMES	20000
+
+//SPI transport stand-in, DMA transfers end when the bus time has passed
+typedef struct {
+	SSD1306_transport_t transport;
+	ssd1306_host_t* panel;
+
+	uint8_t* pending;
+	uint16_t length;
+	uint8_t busy;
+
+	double now_us;
+	double end_us;
+	double waited_us;	/*!< Time spent in flush waiting for the bus */
+} dma_sim_t;
+
+static double bus_us(uint16_t length)
+{
+	return length * 8 * 1e6 / SPI_HZ;
+}
+
+//what the DMA interrupt does
+static void dma_complete(dma_sim_t* sim)
+{
+	sim->now_us = sim->end_us;
+	ssd1306_host_data(sim->panel, sim->pending, sim->length);
+	sim->busy = 0;
+	if(sim->transport.done != NULL)
+		sim->transport.done(&sim->transport);
+}
+
+static HAL_StatusTypeDef dma_flush(SSD1306_transport_t* transport)
+{
+	dma_sim_t* sim = (dma_sim_t*)transport->handle;
+
+	while(sim->busy){
+		sim->waited_us += sim->end_us - sim->now_us;
+		dma_complete(sim);
+	}
+
+	return HAL_OK;
+}
+
+static HAL_StatusTypeDef dma_command(SSD1306_transport_t* transport,
+		uint8_t* commands, uint16_t length)
+{
+	dma_sim_t* sim = (dma_sim_t*)transport->handle;
+
+	dma_flush(transport);
+	ssd1306_host_command(sim->panel, commands, length);
+	sim->now_us += bus_us(length);
+
+	return HAL_OK;
+}
+
+static HAL_StatusTypeDef dma_data(SSD1306_transport_t* transport,
+		uint8_t* data, uint16_t length)
+{
+	dma_sim_t* sim = (dma_sim_t*)transport->handle;
+
+	dma_flush(transport);
+
+	if(length < DMA_THRESHOLD){
+		ssd1306_host_data(sim->panel, data, length);
+		sim->now_us += bus_us(length);
+		if(transport->done != NULL)
+			transport->done(transport);
+		return HAL_OK;
+	}
+
+	sim->pending = data;
+	sim->length = length;
+	sim->busy = 1;
+	sim->end_us = sim->now_us + bus_us(length);
+
+	return HAL_OK;
+}
+
+//the CPU is busy elsewhere until the frame has gone out
+static void dma_idle(dma_sim_t* sim)
+{
+	while(sim->busy)
+		dma_complete(sim);
+}
+
+//glass position of logical pixel x, y: mirrored, then turned clockwise
+static void expected_position(SSD1306_device_t* dev, int x, int y, int* px,
+		int* py)
+{
+	int w = dev->width, h = dev->height;
+
+	if(dev->mirror & SSD1306_MIRROR_X)
+		x = w - 1 - x;
+	if(dev->mirror & SSD1306_MIRROR_Y)
+		y = h - 1 - y;
+
+	switch(dev->rotation){
+	case SSD1306_ROTATE_90:
+		*px = h - 1 - y;
+		*py = x;
+		break;
+	case SSD1306_ROTATE_180:
+		*px = w - 1 - x;
+		*py = h - 1 - y;
+		break;
+	case SSD1306_ROTATE_270:
+		*px = y;
+		*py = w - 1 - x;
+		break;
+	default:
+		*px = x;
+		*py = y;
+		break;
+	}
+}
+
+static uint32_t check_mapping(SSD1306_device_t* dev, ssd1306_host_t* panel,
+		dma_sim_t* sim)
+{
+	static uint8_t expected[SSD1306_HOST_ROWS][SSD1306_HOST_COLUMNS];
+	uint32_t errors = 0;
+	int x, y, px, py;
+	uint8_t lit;
+
+	ssd1306_fill(dev, Black);
+	for(y = 0; y < dev->height; y++)
+		for(x = 0; x < dev->width; x++){
+			lit = rand() & 1;
+			ssd1306_draw_pixel(dev, x, y, lit ? White : Black);
+			expected_position(dev, x, y, &px, &py);
+			expected[py][px] = lit;
+		}
+
+	ssd1306_update_screen(dev);
+	if(sim != NULL)
+		dma_idle(sim);
+
+	for(py = 0; py < SSD1306_HOST_ROWS; py++)
+		for(px = 0; px < SSD1306_HOST_COLUMNS; px++)
+			if(ssd1306_host_get_pixel(panel, px, py) != expected[py][px])
+				errors++;
+
+	return errors;
+}
+
+static uint32_t check_all(SSD1306_device_t* dev, ssd1306_host_t* panel,
+		dma_sim_t* sim, const char* name)
+{
+	uint32_t errors, total = 0;
+	uint8_t rotation, mirror;
+
+	for(rotation = SSD1306_ROTATE_0; rotation <= SSD1306_ROTATE_270; rotation++)
+		for(mirror = 0; mirror < 4; mirror++){
+			ssd1306_set_rotation(dev, rotation, mirror);
+			errors = check_mapping(dev, panel, sim);
+			if(errors)
+				printf("%s: rotation %u mirror %u, %u wrong pixels\n", name,
+						rotation * 90, mirror, errors);
+			total += errors;
+		}
+
+	printf("%s: 16 rotation and mirror mappings, %u wrong pixels\n", name,
+			total);
+
+	return total;
+}
+
+static void bench(SSD1306_device_t* dev, dma_sim_t* sim)
+{
+	double waited, cpu_ns;
+	clock_t start;
+	uint8_t rotation;
+	int i;
+
+	for(rotation = SSD1306_ROTATE_0; rotation <= SSD1306_ROTATE_270; rotation++){
+		ssd1306_set_rotation(dev, rotation, SSD1306_MIRROR_NONE);
+		dma_idle(sim);
+		waited = sim->waited_us;
+
+		//one frame to see how long the call waits for the bus
+		ssd1306_update_screen(dev);
+		waited = sim->waited_us - waited;
+		dma_idle(sim);
+
+		start = clock();
+		for(i = 0; i < BENCH_FRAMES; i++){
+			ssd1306_update_screen(dev);
+			dma_idle(sim);
+		}
+		cpu_ns = (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / BENCH_FRAMES;
+
+		printf("rotation %3u: update waits %7.1f us for the bus, "
+				"frame and interrupts take %6.0f ns of CPU, frame %.0f us on "
+				"the bus\n", rotation * 90, waited, cpu_ns,
+				bus_us(sizeof(dev->buffer)));
+	}
+}
+
+int main(void)
+{
+	static ssd1306_host_t i2c_panel, dma_panel;
+	I2C_HandleTypeDef hi2c;
+	dma_sim_t sim = {.panel = &dma_panel};
+	SSD1306_device_init_t init = {.background = Black, .font = &Font_7x10,
+			.width = 128, .height = 64, .port = &hi2c};
+	SSD1306_device_t* dev;
+	uint32_t errors;
+
+	srand(7);
+
+	ssd1306_host_init(&i2c_panel, 128, 64);
+	ssd1306_host_attach(&i2c_panel, &hi2c);
+	dev = ssd1306_init(&init);
+	if(dev == NULL)
+		return 1;
+	errors = check_all(dev, &i2c_panel, NULL, "I2C");
+
+	sim.transport.handle = &sim;
+	sim.transport.command = &dma_command;
+	sim.transport.data = &dma_data;
+	sim.transport.flush = &dma_flush;
+	ssd1306_host_init(&dma_panel, 128, 64);
+	init.transport = &sim.transport;
+	dev = ssd1306_init(&init);
+	if(dev == NULL)
+		return 1;
+	dma_idle(&sim);
+	errors += check_all(dev, &dma_panel, &sim, "DMA");
+
+	bench(dev, &sim);
+
+	printf(errors ? "FAILED\n" : "passed\n");
+	return errors != 0;
+}
@@ -0,0 +1,58 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Minimal STM32 HAL replacement for building the SSD1306 library
+ *          on a host machine
+ *
+ * Put this directory in front of the real HAL on the include path. The
+ * I2C writes made by ssd1306.c are then decoded by the virtual panel in
+ * ssd1306_host.c instead of going out on a bus.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef SSD1306_HOST_HAL_H_
+#define SSD1306_HOST_HAL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum
+{
+	HAL_OK       = 0x00U,
+	HAL_ERROR    = 0x01U,
+	HAL_BUSY     = 0x02U,
+	HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+/** Stands in for the I2C peripheral, points at the attached virtual panel */
+typedef struct {
+	void* panel;
+} I2C_HandleTypeDef;
+
+void HAL_Delay(uint32_t Delay);
+uint32_t HAL_GetTick(void);
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c,
+		uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize,
+		uint8_t *pData, uint16_t Size, uint32_t Timeout);
+
+#endif /* SSD1306_HOST_HAL_H_ */
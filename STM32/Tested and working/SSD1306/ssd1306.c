@@ -29,18 +29,61 @@
 
 #include"ssd1306.h"
 
-HAL_StatusTypeDef ssd1306_write_command(SSD1306_device_t* self, uint8_t command)
+//I2C transport, the control byte selects between command and data
+static HAL_StatusTypeDef ssd1306_i2c_command(SSD1306_transport_t* transport,
+		uint8_t* commands, uint16_t length)
+{
+	return HAL_I2C_Mem_Write((I2C_HandleTypeDef*)transport->handle,
+			SSD1306_I2C_ADDR, 0x00, 1, commands, length, 10);
+}
+
+static HAL_StatusTypeDef ssd1306_i2c_data(SSD1306_transport_t* transport,
+		uint8_t* data, uint16_t length)
+{
+	if(HAL_I2C_Mem_Write((I2C_HandleTypeDef*)transport->handle,
+			SSD1306_I2C_ADDR, 0x40, 1, data, length, 100) != HAL_OK)
+		return HAL_ERROR;
+
+	if(transport->done != NULL)
+		transport->done(transport);
+
+	return HAL_OK;
+}
+
+//blocking, nothing is ever left in flight
+static HAL_StatusTypeDef ssd1306_i2c_flush(SSD1306_transport_t* transport)
 {
-	if(HAL_I2C_Mem_Write(self->port,SSD1306_I2C_ADDR,0x00,1,&command,1,10) != HAL_OK)
+	(void)transport;
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef ssd1306_write_commands(SSD1306_device_t* self,
+		uint8_t* commands, uint16_t length)
+{
+	if(self->transport->command(self->transport, commands, length) != HAL_OK)
 		return HAL_ERROR;
 
 	return HAL_OK;
 }
 
+HAL_StatusTypeDef ssd1306_write_command(SSD1306_device_t* self, uint8_t command)
+{
+	return ssd1306_write_commands(self, &command, 1);
+}
+
+HAL_StatusTypeDef ssd1306_flush(SSD1306_device_t* self)
+{
+	return self->transport->flush(self->transport);
+}
+
 HAL_StatusTypeDef ssd1306_clear(SSD1306_device_t* self)
 {
 	uint32_t i;
 
+	if(ssd1306_flush(self) != HAL_OK)
+		return HAL_ERROR;
+
 	for(i = 0; i < sizeof(self->buffer); i++)
 	{
 		self->buffer[i] = (self->background == Black) ? 0x00 : 0xFF;
@@ -54,6 +97,10 @@ HAL_StatusTypeDef ssd1306_fill(SSD1306_device_t* self, SSD1306_colour_t color)
 {
 	uint32_t i;
 
+	//a DMA burst of the last frame may still be reading the buffer
+	if(ssd1306_flush(self) != HAL_OK)
+		return HAL_ERROR;
+
 	for(i = 0; i < sizeof(self->buffer); i++)
 	{
 		self->buffer[i] = (color == Black) ? 0x00 : 0xFF;
@@ -62,31 +109,118 @@ HAL_StatusTypeDef ssd1306_fill(SSD1306_device_t* self, SSD1306_colour_t color)
 	return HAL_OK;
 }
 
-HAL_StatusTypeDef ssd1306_update_screen(SSD1306_device_t* self)
+#define SSD1306_TRANSPOSED(rotation)	((rotation) == SSD1306_ROTATE_90 || \
+		(rotation) == SSD1306_ROTATE_270)
+
+//8x8 bit matrix transpose, bit i of in[j] becomes bit j of out[i]
+static void ssd1306_transpose8(const uint8_t* in, uint8_t* out)
 {
+	uint64_t x = 0, t;
 	uint8_t i;
 
-	for (i = 0; i < 8; i++) {
-		ssd1306_write_command(self, 0xB0 + i);
-		ssd1306_write_command(self, 0x00);
-		ssd1306_write_command(self, 0x10);
+	for(i = 0; i < 8; i++)
+		x |= (uint64_t)in[i] << (8 * i);
 
-		if(HAL_I2C_Mem_Write(self->port,SSD1306_I2C_ADDR,0x40,1,
-			&self->buffer[self->width * i], self->width,100) != HAL_OK)
-			return HAL_ERROR;
+	//swap 1x1, then 2x2, then 4x4 blocks across the diagonal
+	t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAull;
+	x ^= t ^ (t << 7);
+	t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCull;
+	x ^= t ^ (t << 14);
+	t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ull;
+	x ^= t ^ (t << 28);
 
-//		HAL_I2C_Mem_Write(&hi2c1,SSD1306_I2C_ADDR,0x40,1,&SSD1306_Buffer[SSD1306_WIDTH * i],SSD1306_WIDTH,100);
-	}
-	return HAL_OK;
+	for(i = 0; i < 8; i++)
+		out[i] = (uint8_t)(x >> (8 * i));
 }
 
-HAL_StatusTypeDef ssd1306_draw_pixel(SSD1306_device_t* self, uint8_t x, uint8_t y, SSD1306_colour_t colour)
+//sends rotated pages while the one before has finished, building the
+//next while each streams. Runs from ssd1306_update_screen and from the
+//transport's done callback, whichever comes last sends the next page
+static void ssd1306_send_pages(SSD1306_device_t* self)
 {
-	if (x >= self->width || y >= self->height)
-	{
+	uint8_t width = self->height;
+	uint8_t i, k;
+
+	do{
+		//a callback arriving mid page leaves the page to the loop
+		if(self->pumping)
+			return;
+		self->pumping = 1;
+
+		while(self->page_next < self->page_count &&
+				self->pages_done == self->page_next){
+			i = self->page_next++;
+			if(self->transport->data(self->transport, self->page[i & 1],
+					width) != HAL_OK){
+				self->page_count = 0;
+				break;
+			}
+
+			//panel page i is built from 8x8 tiles of logical columns 8i to 8i+7
+			if(++i < self->page_count)
+				for(k = 0; k < width / 8; k++)
+					ssd1306_transpose8(&self->buffer[k * self->width + i * 8],
+							&self->page[i & 1][k * 8]);
+		}
+
+		self->pumping = 0;
+		//a page may have finished between the check and clearing pumping
+	}while(self->page_next < self->page_count &&
+			self->pages_done == self->page_next);
+}
+
+static void ssd1306_page_done(SSD1306_transport_t* transport)
+{
+	SSD1306_device_t* self = (SSD1306_device_t*)transport->owner;
+
+	self->pages_done++;
+	ssd1306_send_pages(self);
+}
+
+HAL_StatusTypeDef ssd1306_update_screen(SSD1306_device_t* self)
+{
+	uint8_t k;
+	uint8_t transposed = SSD1306_TRANSPOSED(self->rotation);
+	uint8_t panel_width = transposed ? self->height : self->width;
+	uint8_t panel_pages = (transposed ? self->width : self->height) / 8;
+	//horizontal addressing over the whole panel, the pointer wraps from
+	//the end of one page to the start of the next
+	uint8_t window[6] = {
+		0x21, 0x00, panel_width - 1,	//column address
+		0x22, 0x00, panel_pages - 1		//page address
+	};
+
+	//the previous frame may still be streaming out of the buffers
+	if(ssd1306_flush(self) != HAL_OK)
 		return HAL_ERROR;
-	}
 
+	self->page_count = 0;
+
+	if(ssd1306_write_commands(self, window, sizeof(window)) != HAL_OK)
+		return HAL_ERROR;
+
+	//the buffer is already in GDDRAM order, send it as one burst
+	if(!transposed)
+		return self->transport->data(self->transport, self->buffer,
+				panel_width * panel_pages);
+
+	//page 0 here, the rest follow from the transport's done callback so
+	//that a DMA transport returns at once as it does unrotated
+	for(k = 0; k < panel_width / 8; k++)
+		ssd1306_transpose8(&self->buffer[k * self->width], &self->page[0][k * 8]);
+
+	self->page_next = 0;
+	self->pages_done = 0;
+	self->page_count = panel_pages;
+	ssd1306_send_pages(self);
+
+	return (self->page_count == 0) ? HAL_ERROR : HAL_OK;
+}
+
+//the public drawing functions flush once and then draw through these
+static void ssd1306_set_pixel(SSD1306_device_t* self, uint8_t x, uint8_t y,
+		SSD1306_colour_t colour)
+{
 	if (colour == White)
 	{
 		self->buffer[x + (y / 8) * self->width] |= 1 << (y % 8);
@@ -95,18 +229,17 @@ HAL_StatusTypeDef ssd1306_draw_pixel(SSD1306_device_t* self, uint8_t x, uint8_t
 	{
 		self->buffer[x + (y / 8) * self->width] &= ~(1 << (y % 8));
 	}
-
-	return HAL_OK;
 }
 
-HAL_StatusTypeDef ssd1306_write_char(SSD1306_device_t* self, char ch, FontDef Font, SSD1306_colour_t color)
+static void ssd1306_draw_char(SSD1306_device_t* self, char ch, FontDef Font,
+		SSD1306_colour_t color)
 {
 	uint32_t i, b, j;
 	
 	if (self->width <= (self->x + Font.FontWidth) ||
 		self->height <= (self->y + Font.FontHeight))
 	{
-		return 0;
+		return;
 	}
 	
 	for (i = 0; i < Font.FontHeight; i++)
@@ -116,20 +249,41 @@ HAL_StatusTypeDef ssd1306_write_char(SSD1306_device_t* self, char ch, FontDef Fo
 		{
 			if ((b << j) & 0x8000) 
 			{
-				if(ssd1306_draw_pixel(self, self->x + j, (self->y + i),
-						(SSD1306_colour_t) color) != HAL_OK)
-					return HAL_ERROR;
+				ssd1306_set_pixel(self, self->x + j, (self->y + i),
+						(SSD1306_colour_t) color);
 			} 
 			else 
 			{
-				if(ssd1306_draw_pixel(self, self->x + j, (self->y + i),
-						(SSD1306_colour_t)!color) != HAL_OK)
-					return HAL_ERROR;
+				ssd1306_set_pixel(self, self->x + j, (self->y + i),
+						(SSD1306_colour_t)!color);
 			}
 		}
 	}
 	
 	self->x += Font.FontWidth;
+}
+
+HAL_StatusTypeDef ssd1306_draw_pixel(SSD1306_device_t* self, uint8_t x, uint8_t y, SSD1306_colour_t colour)
+{
+	if (x >= self->width || y >= self->height)
+	{
+		return HAL_ERROR;
+	}
+
+	if(ssd1306_flush(self) != HAL_OK)
+		return HAL_ERROR;
+
+	ssd1306_set_pixel(self, x, y, colour);
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef ssd1306_write_char(SSD1306_device_t* self, char ch, FontDef Font, SSD1306_colour_t color)
+{
+	if(ssd1306_flush(self) != HAL_OK)
+		return HAL_ERROR;
+
+	ssd1306_draw_char(self, ch, Font, color);
 	
 	return HAL_OK;
 }
@@ -142,13 +296,13 @@ HAL_StatusTypeDef ssd1306_write_string(SSD1306_device_t* self, char* str)
 		colour = 0x01;
 	else
 		colour = 0x00;
+
+	if(ssd1306_flush(self) != HAL_OK)
+		return HAL_ERROR;
+
 	while (*str) 
 	{
-		if (ssd1306_write_char(self, *str, *self->font, colour) != HAL_OK)
-		{
-			return HAL_ERROR;
-		}
-		
+		ssd1306_draw_char(self, *str, *self->font, colour);
 		str++;
 	}
 	
@@ -156,12 +310,171 @@ HAL_StatusTypeDef ssd1306_write_string(SSD1306_device_t* self, char* str)
 }
 
 
+#define PACKED_MASK(bits)	((bits) >= 32 ? 0xFFFFFFFFul : ((1ul << (bits)) - 1))
+
+//replaces the masked bits of one buffer column, bit 0 of value lands on row y
+static void ssd1306_write_column(SSD1306_device_t* self, uint8_t x, uint8_t y,
+		uint32_t mask, uint32_t value)
+{
+	uint8_t* column = &self->buffer[x + (y / 8) * self->width];
+	uint64_t m = (uint64_t)mask << (y % 8);
+	uint64_t v = (uint64_t)value << (y % 8);
+
+	while(m){
+		*column = (*column & ~(uint8_t)m) | ((uint8_t)v & (uint8_t)m);
+		m >>= 8;
+		v >>= 8;
+		column += self->width;
+	}
+}
+
+//the first overlap columns are only inked, not cleared, so that a kerned
+//glyph does not erase the end of the previous one
+static void ssd1306_draw_packed(SSD1306_device_t* self, char ch,
+		const PackedFontDef* font, SSD1306_colour_t colour, uint8_t overlap)
+{
+	const PackedGlyph* glyph;
+	const uint8_t* data;
+	uint64_t bits = 0;
+	uint8_t bit_count = 0;
+	uint32_t cell_mask, row_mask, ink;
+	uint8_t i;
+
+	if(ch < font->first_char || ch > font->last_char)
+		ch = font->first_char;
+
+	glyph = &font->glyphs[ch - font->first_char];
+
+	if(self->width < (self->x + glyph->advance) ||
+		self->height < (self->y + font->height))
+	{
+		return;
+	}
+
+	data = font->data + glyph->offset;
+	cell_mask = PACKED_MASK(font->height);
+	row_mask = PACKED_MASK(glyph->rows);
+
+	//decode one column at a time straight into the page buffer
+	for(i = 0; i < glyph->advance; i++){
+		ink = 0;
+		if(i < glyph->width){
+			while(bit_count < glyph->rows){
+				bits |= (uint64_t)*data++ << bit_count;
+				bit_count += 8;
+			}
+			ink = ((uint32_t)bits & row_mask) << glyph->y_offset;
+			bits >>= glyph->rows;
+			bit_count -= glyph->rows;
+		}
+
+		ssd1306_write_column(self, self->x + i, self->y,
+				(i < overlap) ? ink : cell_mask,
+				(colour == White) ? ink : ~ink);
+	}
+
+	self->x += glyph->advance;
+}
+
+HAL_StatusTypeDef ssd1306_write_char_packed(SSD1306_device_t* self, char ch,
+		const PackedFontDef* font, SSD1306_colour_t colour)
+{
+	if(ssd1306_flush(self) != HAL_OK)
+		return HAL_ERROR;
+
+	ssd1306_draw_packed(self, ch, font, colour, 0);
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef ssd1306_write_string_packed(SSD1306_device_t* self,
+		char* str, const PackedFontDef* font)
+{
+	SSD1306_colour_t colour = (self->background == Black) ? White : Black;
+	uint8_t overlap = 0;
+	int8_t kern;
+
+	if(ssd1306_flush(self) != HAL_OK)
+		return HAL_ERROR;
+
+	while (*str)
+	{
+		ssd1306_draw_packed(self, *str, font, colour, overlap);
+
+		overlap = 0;
+		if(font->kerning && str[1]){
+			kern = packed_font_kerning(font, str[0], str[1]);
+			if(kern < 0 && self->x >= -kern){
+				self->x += kern;
+				overlap = -kern;
+			}
+		}
+
+		str++;
+	}
+
+	return HAL_OK;
+}
+
 void ssd1306_set_cursor(SSD1306_device_t* self, uint8_t x, uint8_t y)
 {
 	self->x = x;
 	self->y = y;
 }
 
+HAL_StatusTypeDef ssd1306_set_rotation(SSD1306_device_t* self,
+		SSD1306_rotation_t rotation, uint8_t mirror)
+{
+	//segment remap and COM scan direction for each rotation, 90 and 270
+	//are the transpose done in ssd1306_update_screen plus one of the flips
+	static const uint8_t remap[4][2] = {
+		{1, 1},	//0
+		{0, 1},	//90
+		{0, 0},	//180
+		{1, 0}	//270
+	};
+	uint8_t transposed = SSD1306_TRANSPOSED(rotation);
+	uint8_t segment, com, tmp;
+
+	if(rotation > SSD1306_ROTATE_270)
+		return HAL_ERROR;
+
+	segment = remap[rotation][0];
+	com = remap[rotation][1];
+
+	//mirroring is of the drawn image, once transposed its X axis runs
+	//along the COMs
+	if(mirror & SSD1306_MIRROR_X){
+		if(transposed) com ^= 1;
+		else segment ^= 1;
+	}
+	if(mirror & SSD1306_MIRROR_Y){
+		if(transposed) segment ^= 1;
+		else com ^= 1;
+	}
+
+	if(transposed != SSD1306_TRANSPOSED(self->rotation)){
+		tmp = self->width;
+		self->width = self->height;
+		self->height = tmp;
+	}
+
+	self->rotation = rotation;
+	self->mirror = mirror;
+
+	if(ssd1306_write_command(self, 0xA0 | segment) != HAL_OK)
+		return HAL_ERROR;
+	if(ssd1306_write_command(self, 0xC0 | (com << 3)) != HAL_OK)
+		return HAL_ERROR;
+
+	//the segment remap only applies to newly written data and the buffer
+	//layout may have changed, so the screen has to be redrawn
+	ssd1306_fill(self, self->background);
+	ssd1306_set_cursor(self, 0, 0);
+
+	return HAL_OK;
+}
+
 SSD1306_device_t* ssd1306_init(SSD1306_device_init_t* init_dev_vals)
 {
 	HAL_Delay(100);
@@ -180,6 +493,18 @@ SSD1306_device_t* ssd1306_init(SSD1306_device_init_t* init_dev_vals)
 
 	init_dev->port = init_dev_vals->port;
 
+	if(init_dev_vals->transport == NULL){
+		init_dev->i2c.handle = init_dev_vals->port;
+		init_dev->i2c.command = &ssd1306_i2c_command;
+		init_dev->i2c.data = &ssd1306_i2c_data;
+		init_dev->i2c.flush = &ssd1306_i2c_flush;
+		init_dev->transport = &init_dev->i2c;
+	}else
+		init_dev->transport = init_dev_vals->transport;
+
+	init_dev->transport->done = &ssd1306_page_done;
+	init_dev->transport->owner = init_dev;
+
 	init_dev->width = init_dev_vals->width;
 	init_dev->height = init_dev_vals->height;
 
@@ -189,7 +514,7 @@ SSD1306_device_t* ssd1306_init(SSD1306_device_init_t* init_dev_vals)
 	/* Init LCD */
 	ssd1306_write_command(init_dev, 0xAE); //display off
 	ssd1306_write_command(init_dev, 0x20); //memory addressing mode
-	ssd1306_write_command(init_dev, 0x10); //00,Horizontal Addressing Mode;01,Vertical Addressing Mode;10,Page Addressing Mode (RESET);11,Invalid
+	ssd1306_write_command(init_dev, 0x00); //00,Horizontal Addressing Mode;01,Vertical Addressing Mode;10,Page Addressing Mode (RESET);11,Invalid
 	ssd1306_write_command(init_dev, 0xB0); //Set Page Start Address for Page Addressing Mode,0-7
 	ssd1306_write_command(init_dev, 0xC8); //Set COM Output Scan Direction
 	ssd1306_write_command(init_dev, 0x00); //---set low column address
@@ -216,6 +541,9 @@ SSD1306_device_t* ssd1306_init(SSD1306_device_init_t* init_dev_vals)
 	ssd1306_write_command(init_dev, 0x14); //
 	ssd1306_write_command(init_dev, 0xAF); //--turn on SSD1306 panel
 
+	ssd1306_set_rotation(init_dev, init_dev_vals->rotation,
+			init_dev_vals->mirror);
+
 	ssd1306_fill(init_dev, init_dev->background);
 
 	ssd1306_update_screen(init_dev);
@@ -30,6 +30,7 @@
 
 #include "stm32f4xx_hal.h"
 #include "fonts.h"
+#include "fonts_packed.h"
 
 #ifndef ssd1306
 #define ssd1306
@@ -53,6 +54,46 @@ typedef enum {
 	White = 0x01  /*!< Pixel is set. Color depends on LCD */
 } SSD1306_colour_t;
 
+/**
+ * Rotation of the drawn image on the panel, clockwise. 90 and 270 swap
+ * the width and height used for drawing.
+ */
+typedef enum {
+	SSD1306_ROTATE_0 = 0,
+	SSD1306_ROTATE_90,
+	SSD1306_ROTATE_180,
+	SSD1306_ROTATE_270
+} SSD1306_rotation_t;
+
+/** Mirroring of the drawn image, applied before rotation */
+#define SSD1306_MIRROR_NONE		0x00
+#define SSD1306_MIRROR_X		0x01
+#define SSD1306_MIRROR_Y		0x02
+
+/**
+ * Bus the controller is attached to. Commands and GDDRAM data are sent
+ * through these operations so that the drawing code does not depend on
+ * the bus. A data transfer may still be running when data returns (eg.
+ * DMA), flush waits until the bus is idle and the data buffer is free.
+ * Every drawing function flushes once on entry, before it touches the
+ * buffer, so a frame is never changed while it is being sent. Code that
+ * writes the buffer directly must call ssd1306_flush first.
+ */
+typedef struct SSD1306_transport SSD1306_transport_t;
+struct SSD1306_transport{
+	void* handle;	/*!< Bus specific state, passed back to the operations */
+
+	HAL_StatusTypeDef (*command)(SSD1306_transport_t*, uint8_t*, uint16_t);
+	HAL_StatusTypeDef (*data)(SSD1306_transport_t*, uint8_t*, uint16_t);
+	HAL_StatusTypeDef (*flush)(SSD1306_transport_t*);
+
+	//set by the driver, called once for every data transfer that has
+	//ended: before data returns for a blocking transfer, from the
+	//interrupt for one left running, never for one that failed
+	void (*done)(SSD1306_transport_t*);
+	void* owner;
+};
+
 typedef struct SSD1306_device SSD1306_device_t;
 struct SSD1306_device{
 	uint16_t x;
@@ -67,10 +108,24 @@ struct SSD1306_device{
 	uint8_t width;
 	uint8_t height;
 
+	SSD1306_rotation_t rotation;
+	uint8_t mirror;
+
 	uint8_t buffer [SSD1306_WIDTH * SSD1306_HEIGHT / 8];
 
 	I2C_HandleTypeDef* port;
 
+	SSD1306_transport_t* transport;
+	SSD1306_transport_t i2c;	/*!< Used when no transport is given at init */
+
+	//transposed pages of a 90 or 270 degree frame, the next is built
+	//while the last streams, both must outlive a DMA transfer
+	uint8_t page[2][SSD1306_WIDTH];
+	volatile uint8_t page_next;		//next page to send
+	volatile uint8_t page_count;	//pages in the frame, 0 when not rotated
+	volatile uint8_t pages_done;	//pages the transport has finished
+	volatile uint8_t pumping;		//a page is being sent or built
+
 	HAL_StatusTypeDef (*command)(SSD1306_device_t*, uint8_t);
 	HAL_StatusTypeDef (*clear)(SSD1306_device_t*);
 	HAL_StatusTypeDef (*update)(SSD1306_device_t*);
@@ -87,7 +142,11 @@ typedef struct SSD1306_device_init{
 	uint8_t width;
 	uint8_t height;
 
-	I2C_HandleTypeDef* port;
+	SSD1306_rotation_t rotation;
+	uint8_t mirror;
+
+	I2C_HandleTypeDef* port;		/*!< Used when transport is NULL */
+	SSD1306_transport_t* transport;	/*!< eg. from ssd1306_spi_init, NULL for I2C on port */
 }SSD1306_device_init_t;
 
 SSD1306_device_t* ssd1306_init(SSD1306_device_init_t* init_dev_vals);
@@ -95,11 +154,20 @@ HAL_StatusTypeDef ssd1306_fill(SSD1306_device_t* self, SSD1306_colour_t color);
 HAL_StatusTypeDef ssd1306_update_screen(SSD1306_device_t* self);
 HAL_StatusTypeDef ssd1306_clear(SSD1306_device_t* self);
 HAL_StatusTypeDef ssd1306_write_command(SSD1306_device_t* self, uint8_t command);
+HAL_StatusTypeDef ssd1306_write_commands(SSD1306_device_t* self,
+		uint8_t* commands, uint16_t length);
+HAL_StatusTypeDef ssd1306_flush(SSD1306_device_t* self);
 HAL_StatusTypeDef ssd1306_draw_pixel(SSD1306_device_t* self,
 		uint8_t x, uint8_t y, SSD1306_colour_t colour);
 HAL_StatusTypeDef ssd1306_write_char(SSD1306_device_t* self,
 		char ch, FontDef Font, SSD1306_colour_t color);
 HAL_StatusTypeDef ssd1306_write_string(SSD1306_device_t* self, char* str);
+HAL_StatusTypeDef ssd1306_write_char_packed(SSD1306_device_t* self,
+		char ch, const PackedFontDef* font, SSD1306_colour_t colour);
+HAL_StatusTypeDef ssd1306_write_string_packed(SSD1306_device_t* self,
+		char* str, const PackedFontDef* font);
 void ssd1306_set_cursor(SSD1306_device_t* self, uint8_t x, uint8_t y);
+HAL_StatusTypeDef ssd1306_set_rotation(SSD1306_device_t* self,
+		SSD1306_rotation_t rotation, uint8_t mirror);
 
 #endif
@@ -0,0 +1,280 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Allocation-free number and time formatting for the SSD1306 library
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include "ssd1306_format.h"
+
+static const char digit_pairs[200] = {
+	'0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+	'1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+	'2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+	'3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+	'4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+	'5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+	'6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+	'7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+	'8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+	'9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+};
+
+static const uint32_t pow10[SSD1306_FMT_MAX_DECIMALS + 1] = {
+	1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+//writes the digits of value backwards, ending just before end
+static uint8_t fmt_digits_rev(char* end, uint32_t value)
+{
+	char* p = end;
+	uint32_t q, r;
+
+	//division by a constant compiles to a multiply, two digits per step
+	while(value >= 100){
+		q = value / 100;
+		r = (value - q * 100) * 2;
+		p -= 2;
+		p[0] = digit_pairs[r];
+		p[1] = digit_pairs[r + 1];
+		value = q;
+	}
+
+	if(value >= 10){
+		p -= 2;
+		p[0] = digit_pairs[value * 2];
+		p[1] = digit_pairs[value * 2 + 1];
+	}else
+		*--p = '0' + value;
+
+	return end - p;
+}
+
+//writes exactly width digits of value, zero padded
+static char* fmt_digits_fixed(char* buf, uint32_t value, uint8_t width)
+{
+	char* p = buf + width;
+
+	while(p > buf){
+		*--p = '0' + (value % 10);
+		value /= 10;
+	}
+
+	return buf + width;
+}
+
+//formats a sign and magnitude, the sign is only written if negative
+static uint8_t fmt_signed(char* buf, uint8_t negative, uint32_t magnitude,
+		uint8_t min_width, char pad)
+{
+	char tmp[10];
+	char* p = buf;
+	uint8_t len = fmt_digits_rev(tmp + sizeof(tmp), magnitude);
+	uint8_t total = len + (negative ? 1 : 0);
+	uint8_t i;
+
+	if(min_width > SSD1306_FMT_BUF_SIZE - 1)
+		min_width = SSD1306_FMT_BUF_SIZE - 1;
+
+	if(pad == '0' && negative)
+		*p++ = '-';
+
+	for(i = total; i < min_width; i++)
+		*p++ = pad;
+
+	if(pad != '0' && negative)
+		*p++ = '-';
+
+	for(i = 0; i < len; i++)
+		*p++ = tmp[sizeof(tmp) - len + i];
+
+	*p = '\0';
+
+	return p - buf;
+}
+
+uint8_t ssd1306_fmt_uint(char* buf, uint32_t value, uint8_t min_width, char pad)
+{
+	return fmt_signed(buf, 0, value, min_width, pad);
+}
+
+uint8_t ssd1306_fmt_int(char* buf, int32_t value, uint8_t min_width, char pad)
+{
+	if(value < 0)
+		return fmt_signed(buf, 1, 0u - (uint32_t)value, min_width, pad);
+
+	return fmt_signed(buf, 0, (uint32_t)value, min_width, pad);
+}
+
+//integer part, '.', then decimals digits of frac
+static uint8_t fmt_split(char* buf, uint8_t negative, uint32_t int_part,
+		uint32_t frac, uint8_t decimals)
+{
+	char* p = buf + fmt_signed(buf, negative, int_part, 0, ' ');
+
+	if(decimals){
+		*p++ = '.';
+		p = fmt_digits_fixed(p, frac, decimals);
+	}
+
+	*p = '\0';
+
+	return p - buf;
+}
+
+uint8_t ssd1306_fmt_fixed(char* buf, int32_t value, uint8_t decimals)
+{
+	uint8_t negative = value < 0;
+	uint32_t magnitude = negative ? 0u - (uint32_t)value : (uint32_t)value;
+	uint32_t int_part;
+
+	if(decimals > SSD1306_FMT_MAX_DECIMALS)
+		decimals = SSD1306_FMT_MAX_DECIMALS;
+
+	int_part = magnitude / pow10[decimals];
+
+	return fmt_split(buf, negative, int_part,
+			magnitude - int_part * pow10[decimals], decimals);
+}
+
+uint8_t ssd1306_fmt_q(char* buf, int32_t value, uint8_t frac_bits,
+		uint8_t decimals)
+{
+	uint8_t negative = value < 0;
+	uint32_t magnitude = negative ? 0u - (uint32_t)value : (uint32_t)value;
+	uint32_t int_part, frac;
+
+	if(decimals > SSD1306_FMT_MAX_DECIMALS)
+		decimals = SSD1306_FMT_MAX_DECIMALS;
+	if(frac_bits > 31)
+		frac_bits = 31;
+
+	int_part = magnitude >> frac_bits;
+	frac = magnitude & ((1ul << frac_bits) - 1);
+
+	if(frac_bits){
+		//scale the binary fraction to decimal digits, rounding to nearest
+		frac = (uint32_t)((((uint64_t)frac * pow10[decimals]) +
+				(1ull << (frac_bits - 1))) >> frac_bits);
+		if(frac >= pow10[decimals]){
+			frac -= pow10[decimals];
+			int_part++;
+		}
+	}
+
+	//don't print "-0.00" for values that round to zero
+	if(!int_part && !frac)
+		negative = 0;
+
+	return fmt_split(buf, negative, int_part, frac, decimals);
+}
+
+uint8_t ssd1306_fmt_hms(char* buf, uint8_t hour, uint8_t min, uint8_t sec)
+{
+	buf[0] = digit_pairs[(hour % 100) * 2];
+	buf[1] = digit_pairs[(hour % 100) * 2 + 1];
+	buf[2] = ':';
+	buf[3] = digit_pairs[(min % 100) * 2];
+	buf[4] = digit_pairs[(min % 100) * 2 + 1];
+	buf[5] = ':';
+	buf[6] = digit_pairs[(sec % 100) * 2];
+	buf[7] = digit_pairs[(sec % 100) * 2 + 1];
+	buf[8] = '\0';
+
+	return 8;
+}
+
+HAL_StatusTypeDef ssd1306_write_uint(SSD1306_device_t* self, uint32_t value,
+		uint8_t min_width)
+{
+	char buf[SSD1306_FMT_BUF_SIZE];
+
+	ssd1306_fmt_uint(buf, value, min_width, ' ');
+
+	return ssd1306_write_string(self, buf);
+}
+
+HAL_StatusTypeDef ssd1306_write_int(SSD1306_device_t* self, int32_t value,
+		uint8_t min_width)
+{
+	char buf[SSD1306_FMT_BUF_SIZE];
+
+	ssd1306_fmt_int(buf, value, min_width, ' ');
+
+	return ssd1306_write_string(self, buf);
+}
+
+HAL_StatusTypeDef ssd1306_write_fixed(SSD1306_device_t* self, int32_t value,
+		uint8_t decimals)
+{
+	char buf[SSD1306_FMT_BUF_SIZE];
+
+	ssd1306_fmt_fixed(buf, value, decimals);
+
+	return ssd1306_write_string(self, buf);
+}
+
+HAL_StatusTypeDef ssd1306_write_q(SSD1306_device_t* self, int32_t value,
+		uint8_t frac_bits, uint8_t decimals)
+{
+	char buf[SSD1306_FMT_BUF_SIZE];
+
+	ssd1306_fmt_q(buf, value, frac_bits, decimals);
+
+	return ssd1306_write_string(self, buf);
+}
+
+HAL_StatusTypeDef ssd1306_write_hms(SSD1306_device_t* self,
+		uint8_t hour, uint8_t min, uint8_t sec)
+{
+	char buf[SSD1306_FMT_BUF_SIZE];
+
+	ssd1306_fmt_hms(buf, hour, min, sec);
+
+	return ssd1306_write_string(self, buf);
+}
+
+#ifdef SSD1306_USE_DS3231
+uint8_t ssd1306_fmt_time(char* buf, ds3231Time* time)
+{
+	uint8_t len = ssd1306_fmt_hms(buf, time->hour, time->min, time->sec);
+
+	if(time->twelve_hour){
+		buf[len++] = ' ';
+		buf[len++] = (time->pm == PM) ? 'P' : 'A';
+		buf[len++] = 'M';
+		buf[len] = '\0';
+	}
+
+	return len;
+}
+
+HAL_StatusTypeDef ssd1306_write_time(SSD1306_device_t* self, ds3231Time* time)
+{
+	char buf[SSD1306_FMT_BUF_SIZE];
+
+	ssd1306_fmt_time(buf, time);
+
+	return ssd1306_write_string(self, buf);
+}
+#endif
@@ -0,0 +1,138 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Allocation-free number and time formatting for the SSD1306 library
+ *
+ * Replaces sprintf for putting numbers on the screen. Digits are generated
+ * two at a time from a lookup table into a small caller (or stack) buffer,
+ * no heap is used and nothing from the printf family is linked in.
+ *
+ * The ssd1306_fmt_* functions format into a buffer of at least
+ * SSD1306_FMT_BUF_SIZE bytes and return the string length. The
+ * ssd1306_write_* functions format on the stack and hand the result
+ * straight to the glyph renderer at the current cursor.
+ *
+ * Define SSD1306_USE_DS3231 (and have DS3231_stm32_hal.h on the include
+ * path) to get ssd1306_fmt_time/ssd1306_write_time for ds3231Time.
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef SSD1306_FORMAT_H_
+#define SSD1306_FORMAT_H_
+
+#include "ssd1306.h"
+
+#ifdef SSD1306_USE_DS3231
+#include "DS3231_stm32_hal.h"
+#endif
+
+/** Large enough for any value produced by the formatters plus the '\0' */
+#define SSD1306_FMT_BUF_SIZE		24
+
+/** Largest number of fractional digits accepted by the fixed point formatters */
+#define SSD1306_FMT_MAX_DECIMALS	9
+
+/**
+ * @brief Formats an unsigned integer
+ *
+ * @param buf - Output buffer, at least SSD1306_FMT_BUF_SIZE bytes
+ * @param value - Value to format
+ * @param min_width - Minimum field width, shorter values are left padded
+ * @param pad - Padding character, usually ' ' or '0'
+ * @return Length of the formatted string
+ **/
+uint8_t ssd1306_fmt_uint(char* buf, uint32_t value, uint8_t min_width, char pad);
+
+/**
+ * @brief Formats a signed integer
+ *
+ * Zero padding is placed between the sign and the digits, any other
+ * padding character in front of the sign.
+ *
+ * @param buf - Output buffer, at least SSD1306_FMT_BUF_SIZE bytes
+ * @param value - Value to format
+ * @param min_width - Minimum field width including the sign
+ * @param pad - Padding character, usually ' ' or '0'
+ * @return Length of the formatted string
+ **/
+uint8_t ssd1306_fmt_int(char* buf, int32_t value, uint8_t min_width, char pad);
+
+/**
+ * @brief Formats a decimal fixed point value
+ *
+ * The value is an integer count of 10^-decimals units, eg. 2315 with two
+ * decimals is printed as "23.15".
+ *
+ * @param buf - Output buffer, at least SSD1306_FMT_BUF_SIZE bytes
+ * @param value - Scaled value
+ * @param decimals - Number of fractional digits, 0 to SSD1306_FMT_MAX_DECIMALS
+ * @return Length of the formatted string
+ **/
+uint8_t ssd1306_fmt_fixed(char* buf, int32_t value, uint8_t decimals);
+
+/**
+ * @brief Formats a binary fixed point (Qn) value
+ *
+ * The fraction is rounded to the requested number of decimal digits.
+ *
+ * @param buf - Output buffer, at least SSD1306_FMT_BUF_SIZE bytes
+ * @param value - Value with frac_bits fractional bits
+ * @param frac_bits - Number of fractional bits, 0 to 31
+ * @param decimals - Number of fractional digits, 0 to SSD1306_FMT_MAX_DECIMALS
+ * @return Length of the formatted string
+ **/
+uint8_t ssd1306_fmt_q(char* buf, int32_t value, uint8_t frac_bits,
+		uint8_t decimals);
+
+/**
+ * @brief Formats a time of day as HH:MM:SS
+ *
+ * @param buf - Output buffer, at least 9 bytes
+ * @return Length of the formatted string (8)
+ **/
+uint8_t ssd1306_fmt_hms(char* buf, uint8_t hour, uint8_t min, uint8_t sec);
+
+HAL_StatusTypeDef ssd1306_write_uint(SSD1306_device_t* self, uint32_t value,
+		uint8_t min_width);
+HAL_StatusTypeDef ssd1306_write_int(SSD1306_device_t* self, int32_t value,
+		uint8_t min_width);
+HAL_StatusTypeDef ssd1306_write_fixed(SSD1306_device_t* self, int32_t value,
+		uint8_t decimals);
+HAL_StatusTypeDef ssd1306_write_q(SSD1306_device_t* self, int32_t value,
+		uint8_t frac_bits, uint8_t decimals);
+HAL_StatusTypeDef ssd1306_write_hms(SSD1306_device_t* self,
+		uint8_t hour, uint8_t min, uint8_t sec);
+
+#ifdef SSD1306_USE_DS3231
+/**
+ * @brief Formats a DS3231 time as HH:MM:SS, with a trailing "AM"/"PM" when
+ * the RTC is in 12 hour mode
+ *
+ * @param buf - Output buffer, at least 12 bytes
+ * @return Length of the formatted string
+ **/
+uint8_t ssd1306_fmt_time(char* buf, ds3231Time* time);
+HAL_StatusTypeDef ssd1306_write_time(SSD1306_device_t* self, ds3231Time* time);
+#endif
+
+#endif /* SSD1306_FORMAT_H_ */
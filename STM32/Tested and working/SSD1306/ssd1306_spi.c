@@ -0,0 +1,147 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   4-wire SPI transport for the SSD1306 library
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include "ssd1306_spi.h"
+
+static void ssd1306_spi_select(SSD1306_spi_t* self, GPIO_PinState dc)
+{
+	HAL_GPIO_WritePin(self->dc_port, self->dc_pin, dc);
+	if(self->cs_port != NULL)
+		HAL_GPIO_WritePin(self->cs_port, self->cs_pin, GPIO_PIN_RESET);
+}
+
+static void ssd1306_spi_deselect(SSD1306_spi_t* self)
+{
+	if(self->cs_port != NULL)
+		HAL_GPIO_WritePin(self->cs_port, self->cs_pin, GPIO_PIN_SET);
+}
+
+static void ssd1306_spi_release(SSD1306_spi_t* self)
+{
+	ssd1306_spi_deselect(self);
+	self->busy = 0;
+}
+
+static HAL_StatusTypeDef ssd1306_spi_flush(SSD1306_transport_t* transport)
+{
+	SSD1306_spi_t* self = (SSD1306_spi_t*)transport->handle;
+	uint32_t start;
+
+	//drawing flushes on every call, keep the idle case cheap
+	if(!self->busy)
+		return HAL_OK;
+
+	start = HAL_GetTick();
+	while(self->busy)
+		if(HAL_GetTick() - start > SSD1306_SPI_TIMEOUT){
+			//the transfer did not end, so done is not called
+			HAL_SPI_DMAStop(self->spi);
+			ssd1306_spi_release(self);
+			return HAL_TIMEOUT;
+		}
+
+	return HAL_OK;
+}
+
+static HAL_StatusTypeDef ssd1306_spi_command(SSD1306_transport_t* transport,
+		uint8_t* commands, uint16_t length)
+{
+	SSD1306_spi_t* self = (SSD1306_spi_t*)transport->handle;
+	HAL_StatusTypeDef ret;
+
+	//D/C may only change once the last data byte is out
+	if(ssd1306_spi_flush(transport) != HAL_OK)
+		return HAL_ERROR;
+
+	ssd1306_spi_select(self, GPIO_PIN_RESET);
+	ret = HAL_SPI_Transmit(self->spi, commands, length, SSD1306_SPI_TIMEOUT);
+	ssd1306_spi_deselect(self);
+
+	return ret;
+}
+
+static HAL_StatusTypeDef ssd1306_spi_data(SSD1306_transport_t* transport,
+		uint8_t* data, uint16_t length)
+{
+	SSD1306_spi_t* self = (SSD1306_spi_t*)transport->handle;
+	HAL_StatusTypeDef ret;
+
+	if(ssd1306_spi_flush(transport) != HAL_OK)
+		return HAL_ERROR;
+
+	ssd1306_spi_select(self, GPIO_PIN_SET);
+
+	if(self->dma_threshold && length >= self->dma_threshold){
+		//CS is released by ssd1306_spi_tx_complete
+		self->busy = 1;
+		ret = HAL_SPI_Transmit_DMA(self->spi, data, length);
+		if(ret != HAL_OK){
+			self->busy = 0;
+			ssd1306_spi_deselect(self);
+		}
+		return ret;
+	}
+
+	ret = HAL_SPI_Transmit(self->spi, data, length, SSD1306_SPI_TIMEOUT);
+	ssd1306_spi_deselect(self);
+
+	if(ret == HAL_OK && transport->done != NULL)
+		transport->done(transport);
+
+	return ret;
+}
+
+void ssd1306_spi_tx_complete(SSD1306_spi_t* self)
+{
+	ssd1306_spi_release(self);
+
+	//may start the next page of a rotated frame
+	if(self->transport.done != NULL)
+		self->transport.done(&self->transport);
+}
+
+SSD1306_transport_t* ssd1306_spi_init(SSD1306_spi_t* self)
+{
+	self->transport.handle = self;
+	self->transport.command = &ssd1306_spi_command;
+	self->transport.data = &ssd1306_spi_data;
+	self->transport.flush = &ssd1306_spi_flush;
+	self->transport.done = NULL;
+	self->busy = 0;
+
+	ssd1306_spi_deselect(self);
+
+	//RES# low for at least 3us resets the controller, ssd1306_init waits
+	//long enough afterwards
+	if(self->reset_port != NULL){
+		HAL_GPIO_WritePin(self->reset_port, self->reset_pin, GPIO_PIN_RESET);
+		HAL_Delay(1);
+		HAL_GPIO_WritePin(self->reset_port, self->reset_pin, GPIO_PIN_SET);
+	}
+
+	return &self->transport;
+}
@@ -0,0 +1,90 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   4-wire SPI transport for the SSD1306 library
+ *
+ * Commands are sent with D/C low using a blocking transmit, GDDRAM data
+ * with D/C high. Data transfers of dma_threshold bytes or more are
+ * started with HAL_SPI_Transmit_DMA and return immediately, a full frame
+ * is then one DMA burst and the CPU is free to draw the next one. Call
+ * ssd1306_spi_tx_complete from HAL_SPI_TxCpltCallback to release CS and
+ * the bus, a 90 or 270 degree frame sends its next page from there. The
+ * driver flushes before touching the bus again, call ssd1306_flush
+ * before drawing if the frame in flight must not tear.
+ *
+ * Usage:
+ *	SSD1306_spi_t spi = {
+ *		.spi = &hspi1,
+ *		.dc_port = GPIOB, .dc_pin = GPIO_PIN_0,
+ *		.cs_port = GPIOB, .cs_pin = GPIO_PIN_1,
+ *		.reset_port = GPIOB, .reset_pin = GPIO_PIN_2,
+ *		.dma_threshold = 32
+ *	};
+ *	SSD1306_device_init_t init = { ..., .transport = ssd1306_spi_init(&spi) };
+ *
+ *	void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+ *	{
+ *		if(hspi == spi.spi)
+ *			ssd1306_spi_tx_complete(&spi);
+ *	}
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef SSD1306_SPI_H_
+#define SSD1306_SPI_H_
+
+#include "ssd1306.h"
+
+#define SSD1306_SPI_TIMEOUT		100
+
+typedef struct SSD1306_spi{
+	SSD1306_transport_t transport;
+
+	SPI_HandleTypeDef* spi;
+
+	GPIO_TypeDef* dc_port;
+	uint16_t dc_pin;
+	GPIO_TypeDef* cs_port;		/*!< NULL if CS is tied low or driven by NSS */
+	uint16_t cs_pin;
+	GPIO_TypeDef* reset_port;	/*!< NULL if RES# is not connected */
+	uint16_t reset_pin;
+
+	uint16_t dma_threshold;		/*!< Smaller data writes are blocking, 0 never uses DMA */
+
+	volatile uint8_t busy;		/*!< DMA transfer in flight */
+}SSD1306_spi_t;
+
+/**
+ * @brief Sets up the transport and pulses the panel's reset line
+ *
+ * @param self - SPI transport with the bus and pins filled in
+ * @return Transport to pass to ssd1306_init
+ **/
+SSD1306_transport_t* ssd1306_spi_init(SSD1306_spi_t* self);
+
+/**
+ * @brief Ends a DMA data transfer, call from HAL_SPI_TxCpltCallback
+ **/
+void ssd1306_spi_tx_complete(SSD1306_spi_t* self);
+
+#endif /* SSD1306_SPI_H_ */
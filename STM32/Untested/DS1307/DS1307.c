@@ -1,38 +1,7 @@
 #include "DS1307.h"
+#include "rtc_codec.h"
 
-#define DS1307_ADDR8    0xD0
-
-//flags
-#define CLOCK_HALT      7
-#define TWELVE_24       6
-#define AM_PM_FLAG      5
-#define CTL_OUT         7
-#define CTL_SQWE        4
-#define CTL_RS1         1
-#define CTL_RS0         0
-
-//register adresses
-#define DS1307_SECONDS  0x00
-#define DS1307_MINUTES  0x01
-#define DS1307_HOURS    0x02
-#define DS1307_DAYS     0x03
-#define DS1307_DATE     0x04
-#define DS1307_MONTHS   0x05
-#define DS1307_YEARS    0x06
-#define DS1307_CONTROL  0x07
-#define DS1307_RAM      0x08
-
-uint8_t dec2bcd(uint8_t d)
-{
-  return ((d/10 * 16) + (d % 10));
-}
-
-uint8_t bcd2dec(uint8_t b)
-{
-  return ((b/16 * 10) + (b % 16));
-}
-
-DS1307_ERR_t DS1307_get_time(DS1307_deivce_t* dev)
+DS1307_ERR_t DS1307_get_time(DS1307_device_t* dev)
 {
     uint8_t read_buffer[8];
 
@@ -40,69 +9,72 @@ DS1307_ERR_t DS1307_get_time(DS1307_deivce_t* dev)
 			read_buffer, 8, 10) != HAL_OK)
 		return DS1307_i2c;
 
-    dev->time.tm_sec = bcd2dec(read_buffer[0] & 0x7F);
-    dev->time.tm_min = bcd2dec(read_buffer[1] & 0x7F);
+    dev->time.tm_sec = rtc_bcd2dec(read_buffer[0] & 0x7F);
+    dev->time.tm_min = rtc_bcd2dec(read_buffer[1] & 0x7F);
     //hours
-    if((read_buffer >> TWELVE_24) & 0x01){
-        //12 hrs
-        if((read_buffer >> AM_PM_FLAG) & 0x01)
-            dev->time.tm_hours = bcd2dec(read_buffer[2] & 0x0F) + 12;
-        else dev->time.tm_hour = bcd2dec(read_buffer[2] & 0x0F);
+    if((read_buffer[2] >> TWELVE_24) & 0x01){
+        //12 hrs, 12 AM is midnight
+        dev->time.tm_hour = rtc_bcd2dec(read_buffer[2] & 0x1F) % 12;
+        if((read_buffer[2] >> AM_PM_FLAG) & 0x01)
+            dev->time.tm_hour += 12;
     }else //24 hrs
-        dev->time.tm_hour = bcd2dec(read_buffer[2] & 0x3F); 
+        dev->time.tm_hour = rtc_bcd2dec(read_buffer[2] & 0x3F); 
 
+    //struct tm counts months from 0 and years from 1900
     dev->time.tm_wday = (read_buffer[3] & 0x07) - 1;
-    dev->time.tm_mday = bcd2dec(read_buffer[4] & 0x3F);
-    dev->time.tm_mon = bcd2dec(read_buffer[5] & 0x1F);
-    dev->time.tm_year = bcd2dec(read_buffer[6]);
+    dev->time.tm_mday = rtc_bcd2dec(read_buffer[4] & 0x3F);
+    dev->time.tm_mon = rtc_bcd2dec(read_buffer[5] & 0x1F) - 1;
+    dev->time.tm_year = 100 + rtc_bcd2dec(read_buffer[6]);
 
     return DS1307_ok;
 }
 
-DS1307_ERR_t DS1307_set_time(DS1307_deivce_t* dev, tm_t time)
+DS1307_ERR_t DS1307_set_time(DS1307_device_t* dev, tm_t time)
 {
-    uint8_t sec_reg, hours_reg;
-    uint8_t write_buffer[8] = {0};
+    uint8_t sec_reg, hours_reg, hour;
+    uint8_t write_buffer[7] = {0};
 
 	if(HAL_I2C_Mem_Read(dev->i2c_handle, DS1307_ADDR8, DS1307_SECONDS, 1,
-			&sec_reg, 8, 10) != HAL_OK)
+			&sec_reg, 1, 10) != HAL_OK)
 		return DS1307_i2c;
     
 	if(HAL_I2C_Mem_Read(dev->i2c_handle, DS1307_ADDR8, DS1307_HOURS, 1,
-		    &hours_reg, 8, 10) != HAL_OK)
+		    &hours_reg, 1, 10) != HAL_OK)
 		return DS1307_i2c;
 
-    write_buffer[0] = (sec_reg & (1 << CLOCK_HALT)) | dec2bcd(time.tm_sec);
-    write_buffer[1] = dec2bcd(time.tm_min);
-    if((hours_reg >> TWELVE_24) & 0x01)
-        if((time.tm_hour + 1) > 12) //then pm
-            write_buffer[3] |= (1 << TWELVE_24) | (1 << AM_PM_FLAG) | 
-                dec2bcd(time.tm_hour - 11);
-        else write_buffer[3] |= (1 << TWELVE_24) | dec2bcd(time.tm_hour);
-    else
-        write_buffer[3] = dec2bcd(time.tm_hour);
-    write_buffer[4] = dec2bcd(time.tm_wday + 1);
-    write_buffer[5] = dec2bcd(time.tm_mday);
-    write_buffer[6] = dec2bcd(time.tm_mon);
-    write_buffer[7] = dec2bcd(time.tm_year);
-
-    if(HAL_I2C_Mem_Write(dev->i2c_handle, DS1307_ADDR8, 0x00, 1, 
-                write_buffer, 8, 10) != HAL_OK)
+    write_buffer[0] = (sec_reg & (1 << CLOCK_HALT)) | rtc_dec2bcd(time.tm_sec);
+    write_buffer[1] = rtc_dec2bcd(time.tm_min);
+    //keep the 12/24 hour mode the chip is in
+    if((hours_reg >> TWELVE_24) & 0x01){
+        hour = (time.tm_hour % 12) ? (time.tm_hour % 12) : 12;
+        write_buffer[2] = (1 << TWELVE_24) | rtc_dec2bcd(hour);
+        if(time.tm_hour >= 12) //then pm
+            write_buffer[2] |= (1 << AM_PM_FLAG);
+    }else
+        write_buffer[2] = rtc_dec2bcd(time.tm_hour);
+    write_buffer[3] = time.tm_wday + 1;
+    write_buffer[4] = rtc_dec2bcd(time.tm_mday);
+    write_buffer[5] = rtc_dec2bcd(time.tm_mon + 1);
+    write_buffer[6] = rtc_dec2bcd(time.tm_year % 100);
+
+    //control register at 0x07 is left alone
+    if(HAL_I2C_Mem_Write(dev->i2c_handle, DS1307_ADDR8, DS1307_SECONDS, 1, 
+                write_buffer, 7, 10) != HAL_OK)
 		return DS1307_i2c;
 
     return DS1307_ok;
 }
 
-DS1307_ERR_t DS1307_clear_time(DS1307_deivce_t* dev)
+DS1307_ERR_t DS1307_clear_time(DS1307_device_t* dev)
 {
     uint8_t write_buffer[8] = {0};
-    if(HAL_I2C_Mem_Write(self->i2c_handle, DS3231_ADDR8, 
+    if(HAL_I2C_Mem_Write(dev->i2c_handle, DS1307_ADDR8, 
                 0x00, 1, write_buffer, 8, 10) != HAL_OK)
-		return DS3231_i2c;
+		return DS1307_i2c;
     return DS1307_ok;
 }
 
-DS1307_ERR_t DS1307_get_registers(DS1307_deivce_t* dev)
+DS1307_ERR_t DS1307_get_registers(DS1307_device_t* dev)
 {
 	if(HAL_I2C_Mem_Read(dev->i2c_handle, DS1307_ADDR8, 0x00, 1, 
             &dev->registers.seconds, 8, 10) != HAL_OK)
@@ -111,28 +83,57 @@ DS1307_ERR_t DS1307_get_registers(DS1307_deivce_t* dev)
     return DS1307_ok;
 }
 
-DS1307_ERR_t DS1307_get_control(DS1307_deivce_t* dev)
+DS1307_ERR_t DS1307_get_control(DS1307_device_t* dev)
 {
-	if(HAL_I2C_Mem_Read(dev->i2c_handle, DS1307_ADDR8, 0x00, 1, 
+	if(HAL_I2C_Mem_Read(dev->i2c_handle, DS1307_ADDR8, DS1307_CONTROL, 1, 
             &dev->registers.control, 1, 10) != HAL_OK)
         return DS1307_i2c;
 
     return DS1307_ok;
 }
 
-DS1307_ERR_t DS1307_set_control(DS1307_deivce_t* dev, 
+DS1307_ERR_t DS1307_set_control(DS1307_device_t* dev, 
         uint8_t position, uint8_t value)
 {
     uint8_t read_buffer = 0;
 
 	if(HAL_I2C_Mem_Read(dev->i2c_handle, DS1307_ADDR8, DS1307_CONTROL, 1, 
-            &read_buffer, 8, 10) != HAL_OK)
+            &read_buffer, 1, 10) != HAL_OK)
+        return DS1307_i2c;
 
     (value == 1) ? (read_buffer |= (1 << position)) : (read_buffer &= ~(1 << position));
 
-    if(HAL_I2C_Mem_Write(self->i2c_handle, DS3231_ADDR8, 
-                DS1307_CONTROL, 1, write_buffer, 1, 10) != HAL_OK)
-		return DS3231_i2c;
+    if(HAL_I2C_Mem_Write(dev->i2c_handle, DS1307_ADDR8, 
+                DS1307_CONTROL, 1, &read_buffer, 1, 10) != HAL_OK)
+		return DS1307_i2c;
+
+    dev->registers.control = read_buffer;
+
+    return DS1307_ok;
+}
+
+DS1307_ERR_t DS1307_read_ram(DS1307_device_t* dev, uint8_t offset, 
+        uint8_t* data, uint8_t length)
+{
+    if((uint16_t)offset + length > DS1307_RAM_SIZE)
+        return DS1307_mem;
+
+    if(HAL_I2C_Mem_Read(dev->i2c_handle, DS1307_ADDR8, DS1307_RAM + offset, 1, 
+            data, length, 10) != HAL_OK)
+        return DS1307_i2c;
+
+    return DS1307_ok;
+}
+
+DS1307_ERR_t DS1307_write_ram(DS1307_device_t* dev, uint8_t offset, 
+        uint8_t* data, uint8_t length)
+{
+    if((uint16_t)offset + length > DS1307_RAM_SIZE)
+        return DS1307_mem;
+
+    if(HAL_I2C_Mem_Write(dev->i2c_handle, DS1307_ADDR8, DS1307_RAM + offset, 1, 
+            data, length, 10) != HAL_OK)
+        return DS1307_i2c;
 
     return DS1307_ok;
 }
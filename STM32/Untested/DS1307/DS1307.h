@@ -3,7 +3,7 @@
  * @email   alxhoff@gmail.com
  * @website http://alexhoffman.info
  * @license GNU GPL v3
- * @brief   STM32 HAL library to control DS3231 RTC
+ * @brief   STM32 HAL library to control DS1307 RTC
  *	
 @verbatim
    ----------------------------------------------------------------------
@@ -34,6 +34,30 @@
 
 typedef struct tm tm_t;
 
+#define DS1307_ADDR8    0xD0
+
+//flags
+#define CLOCK_HALT      7
+#define TWELVE_24       6
+#define AM_PM_FLAG      5
+#define CTL_OUT         7
+#define CTL_SQWE        4
+#define CTL_RS1         1
+#define CTL_RS0         0
+
+//register adresses
+#define DS1307_SECONDS  0x00
+#define DS1307_MINUTES  0x01
+#define DS1307_HOURS    0x02
+#define DS1307_DAYS     0x03
+#define DS1307_DATE     0x04
+#define DS1307_MONTHS   0x05
+#define DS1307_YEARS    0x06
+#define DS1307_CONTROL  0x07
+#define DS1307_RAM      0x08
+
+#define DS1307_RAM_SIZE 56
+
 typedef struct DS1307_registers
 {                       
     uint8_t seconds;    /**<|CH| 10 SEC(3) |  SECONDS(4) |              00-59*/
@@ -51,7 +75,8 @@ typedef enum
 {
     DS1307_ok,
     DS1307_i2c,
-    DS1307_mem
+    DS1307_mem,
+    DS1307_empty
 }DS1307_ERR_t;
 
 typedef struct DS1307_device DS1307_device_t;
@@ -72,10 +97,28 @@ struct DS1307_device
 };
 
 DS1307_ERR_t DS1307_get_time(DS1307_device_t*);
-DS1307_ERR_t DS1307_set_time(DS1307_device_t*);
+DS1307_ERR_t DS1307_set_time(DS1307_device_t*, tm_t time);
 DS1307_ERR_t DS1307_clear_time(DS1307_device_t*);
 DS1307_ERR_t DS1307_get_registers(DS1307_device_t*);
 DS1307_ERR_t DS1307_get_control(DS1307_device_t*);
 DS1307_ERR_t DS1307_set_control(DS1307_device_t*, uint8_t position, uint8_t value);
 
+/**
+ * @brief Reads from the 56 bytes of battery backed RAM
+ *
+ * @param offset - 0 is the first RAM byte (register 0x08)
+ * @return DS1307_mem if the range runs past the end of the RAM
+ **/
+DS1307_ERR_t DS1307_read_ram(DS1307_device_t*, uint8_t offset, uint8_t* data,
+        uint8_t length);
+
+/**
+ * @brief Writes to the 56 bytes of battery backed RAM
+ *
+ * @param offset - 0 is the first RAM byte (register 0x08)
+ * @return DS1307_mem if the range runs past the end of the RAM
+ **/
+DS1307_ERR_t DS1307_write_ram(DS1307_device_t*, uint8_t offset, uint8_t* data,
+        uint8_t length);
+
 #endif //DS1307_STM32_H_
@@ -0,0 +1,226 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Sequence numbered record journal in the DS1307 RAM
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <string.h>
+
+#include "DS1307_journal.h"
+
+//CRC-8, polynomial 0x07, starting at 0xFF so that cleared RAM is not intact
+static uint8_t journal_crc8(const uint8_t* data, uint8_t length)
+{
+    uint8_t crc = 0xFF;
+    uint8_t i;
+
+    while(length--){
+        crc ^= *data++;
+        for(i = 0; i < 8; i++)
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+    }
+
+    return crc;
+}
+
+static uint8_t* journal_slot(DS1307_journal_t* journal, uint8_t slot)
+{
+    return &journal->image[slot * journal->slot_size];
+}
+
+static uint8_t journal_intact(DS1307_journal_t* journal, uint8_t slot)
+{
+    uint8_t* p = journal_slot(journal, slot);
+    uint8_t length = journal->slot_size - 1;
+
+    return journal_crc8(p, length) == p[length];
+}
+
+static uint16_t journal_sequence(DS1307_journal_t* journal, uint8_t slot)
+{
+    uint8_t* p = journal_slot(journal, slot);
+
+    return p[0] | (p[1] << 8);
+}
+
+DS1307_ERR_t DS1307_journal_mount(DS1307_journal_t* journal,
+        DS1307_device_t* dev, uint8_t offset, uint8_t length,
+        uint8_t record_size)
+{
+    uint16_t sequence;
+    DS1307_ERR_t ret;
+    uint8_t slot;
+
+    memset(journal, 0, sizeof(DS1307_journal_t));
+
+    if((uint16_t)offset + length > DS1307_RAM_SIZE)
+        return DS1307_mem;
+
+    //two slots must fit in the RAM, this also keeps slot_size from wrapping
+    if(record_size > DS1307_RAM_SIZE / 2 - DS1307_JOURNAL_OVERHEAD)
+        return DS1307_mem;
+
+    journal->dev = dev;
+    journal->offset = offset;
+    journal->record_size = record_size;
+    journal->slot_size = record_size + DS1307_JOURNAL_OVERHEAD;
+    journal->slot_count = length / journal->slot_size;
+    journal->stale = DS1307_JOURNAL_NO_SLOT;
+
+    //with one slot a cut write would destroy the only record
+    if(journal->slot_count < 2)
+        return DS1307_mem;
+
+    ret = DS1307_read_ram(dev, offset, journal->image,
+            journal->slot_count * journal->slot_size);
+    if(ret != DS1307_ok)
+        return ret;
+
+    for(slot = 0; slot < journal->slot_count; slot++){
+        if(!journal_intact(journal, slot))
+            continue;
+
+        sequence = journal_sequence(journal, slot);
+
+        //newer by serial number arithmetic so that the sequence may wrap
+        if(!journal->valid || (int16_t)(sequence - journal->sequence) > 0){
+            journal->valid = 1;
+            journal->current = slot;
+            journal->sequence = sequence;
+        }
+    }
+
+    if(!journal->valid){
+        //first write goes to slot 0
+        journal->current = journal->slot_count - 1;
+        return DS1307_empty;
+    }
+
+    return DS1307_ok;
+}
+
+DS1307_ERR_t DS1307_journal_read(DS1307_journal_t* journal, uint8_t* record)
+{
+    if(!journal->valid)
+        return DS1307_empty;
+
+    memcpy(record, journal_slot(journal, journal->current) + 2,
+            journal->record_size);
+
+    return DS1307_ok;
+}
+
+//sends each run of changed bytes in [from, to), bridging short unchanged gaps
+static DS1307_ERR_t journal_send(DS1307_journal_t* journal, uint8_t slot,
+        const uint8_t* next, uint8_t from, uint8_t to)
+{
+    uint8_t* old = journal_slot(journal, slot);
+    uint8_t base = journal->offset + slot * journal->slot_size;
+    uint8_t full = (slot == journal->stale);
+    uint8_t start, end, i = from;
+    DS1307_ERR_t ret;
+
+    while(i < to){
+        if(!full && next[i] == old[i]){
+            i++;
+            continue;
+        }
+
+        start = i;
+        end = i;
+        while(++i < to){
+            if(full || next[i] != old[i])
+                end = i;
+            else if(i - end > DS1307_JOURNAL_MERGE_GAP)
+                break;
+        }
+
+        ret = DS1307_write_ram(journal->dev, base + start,
+                (uint8_t*)&next[start], end - start + 1);
+        if(ret != DS1307_ok){
+            //the slot is in an unknown state, rewrite it whole next time
+            journal->stale = slot;
+            return ret;
+        }
+
+        memcpy(&old[start], &next[start], end - start + 1);
+        journal->bytes_written += end - start + 1;
+        journal->transfers++;
+    }
+
+    return DS1307_ok;
+}
+
+DS1307_ERR_t DS1307_journal_write(DS1307_journal_t* journal,
+        const uint8_t* record)
+{
+    uint8_t slot = (journal->current + 1) % journal->slot_count;
+    uint16_t sequence = journal->sequence + 1;
+    uint8_t next[DS1307_RAM_SIZE];
+    DS1307_ERR_t ret;
+
+    next[0] = sequence & 0xFF;
+    next[1] = sequence >> 8;
+    memcpy(&next[2], record, journal->record_size);
+    next[journal->slot_size - 1] = journal_crc8(next, journal->slot_size - 1);
+
+    journal->bytes_written = 0;
+    journal->transfers = 0;
+
+    /* The sequence number goes last. Until it is written the slot carries
+     * an older sequence than the current record, so a write that is cut
+     * short is never mounted, whatever its CRC says. */
+    ret = journal_send(journal, slot, next, 2, journal->slot_size);
+    if(ret == DS1307_ok)
+        ret = journal_send(journal, slot, next, 0, 2);
+    if(ret != DS1307_ok)
+        return ret;
+
+    journal->stale = DS1307_JOURNAL_NO_SLOT;
+    journal->current = slot;
+    journal->sequence = sequence;
+    journal->valid = 1;
+
+    return DS1307_ok;
+}
+
+DS1307_ERR_t DS1307_journal_format(DS1307_journal_t* journal)
+{
+    uint8_t length = journal->slot_count * journal->slot_size;
+    DS1307_ERR_t ret;
+
+    memset(journal->image, 0, length);
+
+    ret = DS1307_write_ram(journal->dev, journal->offset, journal->image,
+            length);
+    if(ret != DS1307_ok)
+        return ret;
+
+    journal->stale = DS1307_JOURNAL_NO_SLOT;
+    journal->valid = 0;
+    journal->sequence = 0;
+    journal->current = journal->slot_count - 1;
+
+    return DS1307_ok;
+}
@@ -0,0 +1,123 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Sequence numbered record journal in the DS1307 RAM
+ *	
+ * A crash safe record store in the DS1307's 56 bytes of battery backed
+ * RAM, for counters and last known state that should survive a reset or
+ * a power cut. The RAM has no write cycle limit and no write time, so a
+ * record can be stored every second, where an AT24Cxx page would wear
+ * out within weeks and stall the bus for its 5 ms write cycle.
+ *
+ * The RAM is split into slots of [sequence LSB, sequence MSB, record,
+ * CRC-8]. Each write goes to the next slot with the next sequence number
+ * and mounting picks the intact slot with the newest sequence, so a write
+ * that is cut short leaves the previous record in place. A copy of the
+ * RAM is kept so that a write only sends the bytes that changed.
+ *
+ * Usage:
+ *	DS1307_journal_t journal;
+ *	if(DS1307_journal_mount(&journal, &rtc, 0, DS1307_RAM_SIZE,
+ *			sizeof(state)) == DS1307_ok)
+ *		DS1307_journal_read(&journal, (uint8_t*)&state);
+ *	...
+ *	DS1307_journal_write(&journal, (uint8_t*)&state);
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef DS1307_JOURNAL_H_
+#define DS1307_JOURNAL_H_
+
+#include "DS1307.h"
+
+/** Sequence number (2 bytes) and CRC (1 byte) stored with every record */
+#define DS1307_JOURNAL_OVERHEAD     3
+
+/** Unchanged bytes between two changed runs that are rewritten rather than
+ * starting a new transfer, a transfer costs about this much in address bytes */
+#define DS1307_JOURNAL_MERGE_GAP    2
+
+#define DS1307_JOURNAL_NO_SLOT      0xFF
+
+typedef struct DS1307_journal DS1307_journal_t;
+
+struct DS1307_journal
+{
+    DS1307_device_t* dev;
+
+    uint8_t offset;         /**< First RAM byte of the journal */
+    uint8_t record_size;    /**< Payload bytes per record */
+    uint8_t slot_size;      /**< record_size + DS1307_JOURNAL_OVERHEAD */
+    uint8_t slot_count;
+    uint8_t current;        /**< Slot holding the latest record */
+    uint8_t valid;          /**< A record has been found or written */
+    uint16_t sequence;      /**< Sequence number of the latest record */
+    uint8_t stale;          /**< Slot whose RAM no longer matches the image */
+
+    uint8_t image[DS1307_RAM_SIZE]; /**< Copy of the journal's RAM */
+
+    uint16_t bytes_written; /**< Payload bytes sent by the last write */
+    uint8_t transfers;      /**< I2C writes made by the last write */
+};
+
+/**
+ * @brief Reads the journal's RAM and finds the latest intact record
+ *
+ * @param offset - First RAM byte to use
+ * @param length - RAM bytes to use, at least two slots
+ * @param record_size - Payload bytes per record, at most
+ * DS1307_RAM_SIZE / 2 - DS1307_JOURNAL_OVERHEAD
+ * @return DS1307_ok if a record was recovered, DS1307_empty if none of
+ * the slots holds an intact record (the journal can still be written),
+ * DS1307_mem if the geometry does not fit
+ **/
+DS1307_ERR_t DS1307_journal_mount(DS1307_journal_t* journal,
+        DS1307_device_t* dev, uint8_t offset, uint8_t length,
+        uint8_t record_size);
+
+/**
+ * @brief Copies the latest record
+ *
+ * @param record - record_size bytes
+ * @return DS1307_empty if there is no record
+ **/
+DS1307_ERR_t DS1307_journal_read(DS1307_journal_t* journal, uint8_t* record);
+
+/**
+ * @brief Appends a record
+ *
+ * The record goes to the slot after the current one, so that the current
+ * record stays intact until the new one is complete. Only the bytes that
+ * differ from what the slot already holds are sent.
+ *
+ * @param record - record_size bytes
+ **/
+DS1307_ERR_t DS1307_journal_write(DS1307_journal_t* journal,
+        const uint8_t* record);
+
+/**
+ * @brief Clears every slot so that the journal mounts empty
+ **/
+DS1307_ERR_t DS1307_journal_format(DS1307_journal_t* journal);
+
+#endif //DS1307_JOURNAL_H_
@@ -0,0 +1,165 @@
+/**
+ * @author  Alexander Hoffman
+ * @email   alxhoff@gmail.com
+ * @website http://alexhoffman.info
+ * @license GNU GPL v3
+ * @brief   Common RTC interface backend for the STM32 DS1307 library
+ *	
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include "rtc.h"
+#include "DS1307.h"
+
+static I2C_HandleTypeDef* rtc_port = NULL;
+static DS1307_device_t rtc_dev;
+
+static rtc_err_t rtc_read(uint8_t address, uint8_t* data, uint8_t length)
+{
+	if(HAL_I2C_Mem_Read(rtc_port, DS1307_ADDR8, address, 1, data, length, 10)
+			!= HAL_OK)
+		return RTC_ERR_BUS;
+
+	return RTC_OK;
+}
+
+static rtc_err_t rtc_write(uint8_t address, uint8_t* data, uint8_t length)
+{
+	if(HAL_I2C_Mem_Write(rtc_port, DS1307_ADDR8, address, 1, data, length, 10)
+			!= HAL_OK)
+		return RTC_ERR_BUS;
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_init(void* bus)
+{
+	rtc_port = (I2C_HandleTypeDef*)bus;
+	rtc_dev.i2c_handle = rtc_port;
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_get_datetime(rtc_datetime_t* datetime)
+{
+	uint8_t raw[RTC_BCD_TIME_SIZE];
+
+	if(rtc_read(DS1307_SECONDS, raw, RTC_BCD_TIME_SIZE) != RTC_OK)
+		return RTC_ERR_BUS;
+
+	rtc_decode_bcd_time(raw, datetime);
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_set_datetime(const rtc_datetime_t* datetime)
+{
+	uint8_t raw[RTC_BCD_TIME_SIZE];
+
+	if(datetime->year < 2000 || datetime->year > 2099)
+		return RTC_ERR_RANGE;
+
+	//CH is left clear so that setting the time also starts the oscillator
+	rtc_encode_bcd_time(datetime, raw);
+
+	return rtc_write(DS1307_SECONDS, raw, RTC_BCD_TIME_SIZE);
+}
+
+rtc_err_t rtc_get_epoch(uint32_t* epoch)
+{
+	rtc_datetime_t datetime;
+
+	if(rtc_get_datetime(&datetime) != RTC_OK)
+		return RTC_ERR_BUS;
+
+	*epoch = rtc_to_epoch(&datetime);
+
+	return RTC_OK;
+}
+
+rtc_err_t rtc_set_epoch(uint32_t epoch)
+{
+	rtc_datetime_t datetime;
+
+	rtc_from_epoch(epoch, &datetime);
+
+	return rtc_set_datetime(&datetime);
+}
+
+rtc_err_t rtc_set_alarm(uint32_t epoch)
+{
+	(void)epoch;
+
+	return RTC_ERR_UNSUPPORTED;
+}
+
+rtc_err_t rtc_clear_alarm(void)
+{
+	return RTC_ERR_UNSUPPORTED;
+}
+
+rtc_err_t rtc_alarm_fired(uint8_t* fired)
+{
+	*fired = 0;
+
+	return RTC_ERR_UNSUPPORTED;
+}
+
+rtc_err_t rtc_get_temperature(int16_t* quarter_degrees)
+{
+	(void)quarter_degrees;
+
+	return RTC_ERR_UNSUPPORTED;
+}
+
+uint8_t rtc_sram_size(void)
+{
+	return DS1307_RAM_SIZE;
+}
+
+rtc_err_t rtc_read_sram(uint8_t offset, uint8_t* data, uint8_t length)
+{
+	if(!length)
+		return RTC_OK;
+
+	switch(DS1307_read_ram(&rtc_dev, offset, data, length)){
+	case DS1307_ok:
+		return RTC_OK;
+	case DS1307_mem:
+		return RTC_ERR_RANGE;
+	default:
+		return RTC_ERR_BUS;
+	}
+}
+
+rtc_err_t rtc_write_sram(uint8_t offset, const uint8_t* data, uint8_t length)
+{
+	if(!length)
+		return RTC_OK;
+
+	switch(DS1307_write_ram(&rtc_dev, offset, (uint8_t*)data, length)){
+	case DS1307_ok:
+		return RTC_OK;
+	case DS1307_mem:
+		return RTC_ERR_RANGE;
+	default:
+		return RTC_ERR_BUS;
+	}
+}